@@ -0,0 +1,291 @@
+#include "AlertEngine.h"
+#include "PriceResponseParser.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Levels are sorted by value; crossed ranges are taken with these bounds
+template <typename Level>
+typename std::vector<Level>::iterator UpperBound(std::vector<Level>& levels, double value) {
+    return std::upper_bound(levels.begin(), levels.end(), value,
+        [](double v, const Level& level) { return v < level.value; });
+}
+
+template <typename Level>
+typename std::vector<Level>::iterator LowerBound(std::vector<Level>& levels, double value) {
+    return std::lower_bound(levels.begin(), levels.end(), value,
+        [](const Level& level, double v) { return level.value < v; });
+}
+
+template <typename Level>
+void EraseLevel(std::vector<Level>& levels, double value, uint32_t alert) {
+    auto it = LowerBound(levels, value);
+    for (; it != levels.end() && it->value == value; ++it) {
+        if (it->alert == alert) {
+            levels.erase(it);
+            return;
+        }
+    }
+}
+
+} // namespace
+
+AlertEngine::AlertEngine(const AlertPolicy& policy)
+    : policy(policy) {
+}
+
+bool AlertEngine::Met(const Alert& alert, double value) {
+    return alert.rule.direction == AlertDirection::Above
+        ? value >= alert.rule.threshold
+        : value <= alert.rule.threshold;
+}
+
+void AlertEngine::Index(uint32_t a, bool keep_sorted) {
+    Alert& alert = alerts[a];
+    alert.slot = NONE;
+    alert.armed = false;
+    if (!catalog) return;
+
+    size_t found = catalog->Index().FindById(alert.rule.coin_id);
+    if (found == CoinIndex::NOT_FOUND) return;
+    alert.slot = static_cast<uint32_t>(found);
+
+    std::unique_ptr<CoinAlerts>& coin = by_slot[alert.slot];
+    if (!coin) {
+        coin = std::make_unique<CoinAlerts>();
+    }
+    FieldIndex& index = coin->fields[static_cast<size_t>(alert.rule.field)];
+
+    // Prices re-arm relative to the threshold, changes by percentage points
+    bool price = alert.rule.field == AlertField::Price;
+    double hysteresis = alert.rule.hysteresis >= 0.0 ? alert.rule.hysteresis
+        : (price ? policy.price_hysteresis : policy.change_hysteresis);
+    double band = price ? hysteresis * std::fabs(alert.rule.threshold) : hysteresis;
+
+    bool above = alert.rule.direction == AlertDirection::Above;
+    alert.rearm_level = above ? alert.rule.threshold - band : alert.rule.threshold + band;
+    std::vector<Level>& thresholds = above ? index.above : index.below;
+    std::vector<Level>& rearms = above ? index.above_rearm : index.below_rearm;
+    Level threshold{ alert.rule.threshold, a };
+    Level rearm{ alert.rearm_level, a };
+    if (keep_sorted) {
+        thresholds.insert(std::upper_bound(thresholds.begin(), thresholds.end(), threshold), threshold);
+        rearms.insert(std::upper_bound(rearms.begin(), rearms.end(), rearm), rearm);
+    }
+    else {
+        thresholds.push_back(threshold);
+        rearms.push_back(rearm);
+    }
+
+    // Armed only on the near side of the threshold
+    alert.armed = !std::isnan(index.last) && !Met(alert, index.last);
+}
+
+void AlertEngine::Unindex(uint32_t a) {
+    Alert& alert = alerts[a];
+    if (alert.slot == NONE) return;
+
+    std::unique_ptr<CoinAlerts>& coin = by_slot[alert.slot];
+    FieldIndex& index = coin->fields[static_cast<size_t>(alert.rule.field)];
+    if (alert.rule.direction == AlertDirection::Above) {
+        EraseLevel(index.above, alert.rule.threshold, a);
+        EraseLevel(index.above_rearm, alert.rearm_level, a);
+    }
+    else {
+        EraseLevel(index.below, alert.rule.threshold, a);
+        EraseLevel(index.below_rearm, alert.rearm_level, a);
+    }
+    if (index.Empty()) {
+        index.last = std::numeric_limits<double>::quiet_NaN();     // No longer followed
+    }
+    if (coin->fields[0].Empty() && coin->fields[1].Empty()) {
+        coin.reset();
+    }
+    alert.slot = NONE;
+}
+
+void AlertEngine::Bind(std::shared_ptr<const CoinCatalog> next, const CoinStore* values) {
+    catalog = std::move(next);
+    by_slot.clear();
+    by_slot.resize(catalog ? catalog->Size() : 0);
+
+    // Append everything, then sort each list once
+    for (uint32_t a = 0; a < alerts.size(); ++a) {
+        if (alerts[a].id != 0) Index(a, false);
+    }
+    bool seed = values && catalog && values->CatalogPtr() == catalog;
+    for (size_t slot = 0; slot < by_slot.size(); ++slot) {
+        CoinAlerts* coin = by_slot[slot].get();
+        if (!coin) continue;
+        for (FieldIndex& index : coin->fields) {
+            std::sort(index.above.begin(), index.above.end());
+            std::sort(index.above_rearm.begin(), index.above_rearm.end());
+            std::sort(index.below.begin(), index.below.end());
+            std::sort(index.below_rearm.begin(), index.below_rearm.end());
+        }
+        if (seed && values->IsPriced(slot)) {
+            Seed(coin->fields[0], values->Price(slot));
+            Seed(coin->fields[1], values->Change(slot));
+        }
+    }
+    ++revision;
+}
+
+uint64_t AlertEngine::Add(const AlertRule& rule, const CoinStore* values) {
+    if (!std::isfinite(rule.threshold)) return 0;
+
+    uint32_t a;
+    if (!free_alerts.empty()) {
+        a = free_alerts.back();
+        free_alerts.pop_back();
+    }
+    else {
+        a = static_cast<uint32_t>(alerts.size());
+        alerts.emplace_back();
+    }
+    Alert& alert = alerts[a];
+    alert = Alert();
+    alert.id = next_id++;
+    alert.rule = rule;
+    by_id[alert.id] = a;
+    Index(a, true);
+
+    // A coin that just got its first alert has no value yet
+    if (alert.slot != NONE && values && values->CatalogPtr() == catalog && values->IsPriced(alert.slot)) {
+        FieldIndex& index = by_slot[alert.slot]->fields[static_cast<size_t>(rule.field)];
+        if (std::isnan(index.last)) {
+            Seed(index, rule.field == AlertField::Price ? values->Price(alert.slot) : values->Change(alert.slot));
+        }
+    }
+    ++revision;
+    return alert.id;
+}
+
+bool AlertEngine::Remove(uint64_t id) {
+    auto it = by_id.find(id);
+    if (it == by_id.end()) return false;
+
+    uint32_t a = it->second;
+    Unindex(a);
+    alerts[a] = Alert();
+    free_alerts.push_back(a);
+    by_id.erase(it);
+    ++revision;
+    return true;
+}
+
+void AlertEngine::Seed(FieldIndex& index, double value) {
+    if (index.Empty() || std::isnan(value)) return;
+    index.last = value;
+    for (const Level& level : index.above) alerts[level.alert].armed = !Met(alerts[level.alert], value);
+    for (const Level& level : index.below) alerts[level.alert].armed = !Met(alerts[level.alert], value);
+    ++revision;
+}
+
+void AlertEngine::Trigger(Alert& alert, double value, int64_t timestamp_ms) {
+    alert.armed = false;
+    ++alert.triggered;
+    alert.last_triggered_ms = timestamp_ms;
+    ++triggered;
+    ++revision;
+
+    AlertEvent event;
+    event.alert_id = alert.id;
+    event.coin_id = alert.rule.coin_id;
+    event.field = alert.rule.field;
+    event.direction = alert.rule.direction;
+    event.threshold = alert.rule.threshold;
+    event.value = value;
+    event.timestamp_ms = timestamp_ms;
+    log.push_back(std::move(event));
+    while (log.size() > policy.log_capacity) {
+        log.pop_front();
+    }
+}
+
+size_t AlertEngine::Cross(FieldIndex& index, double value, int64_t timestamp_ms) {
+    if (index.Empty() || std::isnan(value)) return 0;
+    double last = index.last;
+    if (std::isnan(last)) {
+        Seed(index, value);
+        return 0;
+    }
+    index.last = value;
+
+    // Armed alerts are on the near side of their threshold and disarmed ones
+    // short of their re-arm level, so only levels between 'last' and 'value'
+    // can change state
+    size_t fired = 0;
+    auto visit = [&](auto begin, auto end, bool trigger) {
+        levels_visited += static_cast<uint64_t>(end - begin);
+        for (auto it = begin; it != end; ++it) {
+            Alert& alert = alerts[it->alert];
+            if (trigger && alert.armed) {
+                Trigger(alert, value, timestamp_ms);
+                ++fired;
+            }
+            else if (!trigger && !alert.armed) {
+                alert.armed = true;
+                ++revision;
+            }
+        }
+    };
+    if (value > last) {
+        visit(UpperBound(index.above, last), UpperBound(index.above, value), true);               // (last, value]
+        visit(LowerBound(index.below_rearm, last), LowerBound(index.below_rearm, value), false);  // [last, value)
+    }
+    else if (value < last) {
+        visit(LowerBound(index.below, value), LowerBound(index.below, last), true);               // [value, last)
+        visit(UpperBound(index.above_rearm, value), UpperBound(index.above_rearm, last), false);  // (value, last]
+    }
+    return fired;
+}
+
+size_t AlertEngine::Evaluate(const PriceUpdate& update) {
+    ++updates;
+    if (update.slot >= by_slot.size()) return 0;
+    CoinAlerts* coin = by_slot[update.slot].get();
+    if (!coin) return 0;
+
+    size_t fired = 0;
+    if (update.fields & StagedQuote::HAS_PRICE) {
+        fired += Cross(coin->fields[static_cast<size_t>(AlertField::Price)], update.price, update.timestamp_ms);
+    }
+    if (update.fields & StagedQuote::HAS_CHANGE) {
+        fired += Cross(coin->fields[static_cast<size_t>(AlertField::Change24h)], update.change_24h, update.timestamp_ms);
+    }
+    return fired;
+}
+
+std::vector<AlertInfo> AlertEngine::Alerts() const {
+    std::vector<AlertInfo> infos;
+    infos.reserve(by_id.size());
+    for (const Alert& alert : alerts) {
+        if (alert.id == 0) continue;
+        AlertInfo info;
+        info.id = alert.id;
+        info.rule = alert.rule;
+        info.active = alert.slot != NONE;
+        info.armed = alert.armed;
+        info.triggered = alert.triggered;
+        info.last_triggered_ms = alert.last_triggered_ms;
+        infos.push_back(std::move(info));
+    }
+    std::sort(infos.begin(), infos.end(), [](const AlertInfo& a, const AlertInfo& b) { return a.id < b.id; });
+    return infos;
+}
+
+AlertStats AlertEngine::Stats() const {
+    AlertStats stats;
+    for (const Alert& alert : alerts) {
+        if (alert.id == 0) continue;
+        ++stats.alerts;
+        stats.active += alert.slot != NONE;
+        stats.armed += alert.armed;
+    }
+    stats.updates = updates;
+    stats.levels_visited = levels_visited;
+    stats.triggered = triggered;
+    return stats;
+}
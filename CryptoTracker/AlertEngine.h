@@ -0,0 +1,229 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "CoinCatalog.h"
+#include "CoinStore.h"
+#include "TickQueue.h"
+
+/**
+ * @brief Value an alert watches
+ */
+enum class AlertField : uint8_t {
+    Price,                                      // USD price
+    Change24h                                   // 24h change in percent
+};
+
+/**
+ * @brief Side of the threshold an alert triggers on
+ */
+enum class AlertDirection : uint8_t {
+    Above,                                      // Value rises to or past the threshold
+    Below                                       // Value falls to or past the threshold
+};
+
+/**
+ * @brief User-defined price or change alert
+ */
+struct AlertRule {
+    std::string coin_id;                        // CoinGecko ID
+    AlertField field = AlertField::Price;
+    AlertDirection direction = AlertDirection::Above;
+    double threshold = 0.0;                     // USD or percent, per 'field'
+    double hysteresis = -1.0;                   // Re-arm distance as in AlertPolicy (negative = policy default)
+};
+
+/**
+ * @brief Alert evaluation options
+ */
+struct AlertPolicy {
+    double price_hysteresis = 0.005;            // Price alerts re-arm once back this fraction of the threshold
+    double change_hysteresis = 0.5;             // Change alerts re-arm once back this many percentage points
+    size_t log_capacity = 500;                  // Triggered alerts kept for the log
+    size_t queue_capacity = 16384;              // Tick queue entries before updates are conflated
+};
+
+/**
+ * @brief An alert and its state
+ */
+struct AlertInfo {
+    uint64_t id = 0;
+    AlertRule rule;
+    bool active = false;                        // Coin is in the tracked list
+    bool armed = false;                         // Triggers on the next crossing
+    uint64_t triggered = 0;                     // Times triggered
+    int64_t last_triggered_ms = 0;              // Time stamp of the last trigger (0 = never)
+};
+
+/**
+ * @brief One triggered alert
+ */
+struct AlertEvent {
+    uint64_t alert_id = 0;
+    std::string coin_id;
+    AlertField field = AlertField::Price;
+    AlertDirection direction = AlertDirection::Above;
+    double threshold = 0.0;
+    double value = 0.0;                         // Value that crossed the threshold
+    int64_t timestamp_ms = 0;
+};
+
+/**
+ * @brief Counters of an AlertEngine
+ */
+struct AlertStats {
+    size_t alerts = 0;
+    size_t active = 0;                          // Alerts on coins of the bound catalog
+    size_t armed = 0;
+    uint64_t updates = 0;                       // Updates evaluated
+    uint64_t levels_visited = 0;                // Threshold/re-arm levels inside a crossed range
+    uint64_t triggered = 0;
+};
+
+/**
+ * @brief Evaluates price and change alerts against price updates
+ *
+ * Every coin with alerts keeps, per field, its alerts' trigger and re-arm
+ * levels in sorted vectors. An update only visits the levels between the
+ * coin's previous and new value (two binary searches per list), so the
+ * cost per update does not grow with the number of alerts that did not
+ * cross. An alert triggers when the value reaches its threshold while
+ * armed, then stays disarmed until the value is back past the threshold
+ * by the hysteresis, so a price hovering at the threshold triggers once.
+ * An alert created on the far side of its threshold waits for that
+ * re-arm first.
+ *
+ * Not thread-safe; PriceManager evaluates on its alert thread under its
+ * own lock.
+ */
+class AlertEngine {
+public:
+    explicit AlertEngine(const AlertPolicy& policy = AlertPolicy());
+
+    /**
+     * @brief Index the alerts by the slots of a coin list
+     *
+     * Alerts on coins missing from the list stay inactive until a later
+     * list has them.
+     * @param values Current prices to arm from (ignored unless its catalog is 'catalog')
+     */
+    void Bind(std::shared_ptr<const CoinCatalog> catalog, const CoinStore* values = nullptr);
+
+    /**
+     * @brief Add an alert
+     * @param values Current prices to arm from when the coin has no value yet
+     * @return Alert ID, 0 if the threshold is not a finite number
+     */
+    uint64_t Add(const AlertRule& rule, const CoinStore* values = nullptr);
+
+    /**
+     * @brief Remove an alert
+     * @return false if the ID is unknown
+     */
+    bool Remove(uint64_t id);
+
+    /**
+     * @brief Evaluate one update of the bound catalog
+     * @return Alerts triggered (appended to the log)
+     */
+    size_t Evaluate(const PriceUpdate& update);
+
+    /**
+     * @brief Triggered alerts, oldest first (at most AlertPolicy::log_capacity)
+     */
+    const std::deque<AlertEvent>& Log() const { return log; }
+
+    /**
+     * @brief All alerts by ID
+     */
+    std::vector<AlertInfo> Alerts() const;
+
+    AlertStats Stats() const;
+
+    /**
+     * @brief Counts additions, removals, triggers and re-arms (changes of Alerts())
+     */
+    uint64_t Revision() const { return revision; }
+
+private:
+    static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+    struct Alert {
+        uint64_t id = 0;                        // 0 = free entry
+        AlertRule rule;
+        uint32_t slot = NONE;                   // Coin in the bound catalog
+        double rearm_level = 0.0;               // Value past which a triggered alert re-arms
+        bool armed = false;
+        uint64_t triggered = 0;
+        int64_t last_triggered_ms = 0;
+    };
+
+    /**
+     * @brief An alert's threshold or re-arm level
+     */
+    struct Level {
+        double value;
+        uint32_t alert;                         // Index into 'alerts'
+
+        bool operator<(const Level& other) const { return value < other.value; }
+    };
+
+    /**
+     * @brief Sorted levels of one coin's alerts on one field
+     */
+    struct FieldIndex {
+        std::vector<Level> above;               // Thresholds of Above alerts
+        std::vector<Level> above_rearm;         // Their re-arm levels
+        std::vector<Level> below;               // Thresholds of Below alerts
+        std::vector<Level> below_rearm;         // Their re-arm levels
+        double last = std::numeric_limits<double>::quiet_NaN(); // Last value seen (NaN = none yet)
+
+        bool Empty() const { return above.empty() && below.empty(); }
+    };
+
+    struct CoinAlerts {
+        FieldIndex fields[2];                   // By AlertField
+    };
+
+    static bool Met(const Alert& alert, double value);
+
+    /**
+     * @brief Insert an alert's levels into its coin's index and set its armed state
+     * @param keep_sorted false to append (the caller sorts the lists afterwards)
+     */
+    void Index(uint32_t alert, bool keep_sorted);
+
+    /**
+     * @brief Remove an alert's levels from its coin's index
+     */
+    void Unindex(uint32_t alert);
+
+    /**
+     * @brief First value of a field: arm every alert whose condition does not hold
+     */
+    void Seed(FieldIndex& index, double value);
+
+    /**
+     * @brief Move a field from its last value to 'value', triggering and re-arming on the way
+     */
+    size_t Cross(FieldIndex& index, double value, int64_t timestamp_ms);
+
+    void Trigger(Alert& alert, double value, int64_t timestamp_ms);
+
+    AlertPolicy policy;
+    std::shared_ptr<const CoinCatalog> catalog;
+    std::vector<Alert> alerts;
+    std::vector<uint32_t> free_alerts;          // Reusable entries of 'alerts'
+    std::unordered_map<uint64_t, uint32_t> by_id;
+    std::vector<std::unique_ptr<CoinAlerts>> by_slot; // Null for coins without alerts
+    std::deque<AlertEvent> log;
+    uint64_t next_id = 1;
+    uint64_t revision = 0;
+    uint64_t updates = 0;
+    uint64_t levels_visited = 0;
+    uint64_t triggered = 0;
+};
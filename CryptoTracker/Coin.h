@@ -1,34 +1,43 @@
 #pragma once
 #include <string>
+#include <string_view>
 
 /**
- * @brief Represents a cryptocurrency with its market data
+ * @brief Catalog entry describing a cryptocurrency to track
  *
- * This struct holds all relevant information about a single cryptocurrency
- * including its price, 24-hour change, and watchlist status.
+ * Owning description used to define the coin universe
+ * (PriceManager::SetTrackedCoins). Once tracked, the strings are interned
+ * into a CoinCatalog and prices live in the columns of a CoinStore.
  */
-struct Coin {
+struct CoinInfo {
     std::string id;           // CoinGecko ID (e.g., "bitcoin")
     std::string symbol;       // Trading symbol (e.g., "BTC")
     std::string name;         // Display name (e.g., "Bitcoin")
-    double price;             // Current price in USD
-    double change_24h;        // 24-hour percentage change
-    bool in_watchlist;        // Is this coin in user's watchlist?
-
-    /**
-     * @brief Default constructor initializing all fields
-     */
-    Coin()
-        : id(""), symbol(""), name(""), price(0.0), change_24h(0.0), in_watchlist(false) {
-    }
 
     /**
-     * @brief Parameterized constructor for creating a coin
+     * @brief Parameterized constructor for creating a catalog entry
      * @param id CoinGecko ID
      * @param symbol Trading symbol
      * @param name Display name
      */
-    Coin(const std::string& id, const std::string& symbol, const std::string& name)
-        : id(id), symbol(symbol), name(name), price(0.0), change_24h(0.0), in_watchlist(false) {
+    CoinInfo(std::string id, std::string symbol, std::string name)
+        : id(std::move(id)), symbol(std::move(symbol)), name(std::move(name)) {
     }
-};
\ No newline at end of file
+};
+
+/**
+ * @brief Represents a cryptocurrency with its market data
+ *
+ * Lightweight view assembled from a CoinStore row: the strings point into
+ * the catalog's interned string pool (always null-terminated, so data()
+ * can be passed to C APIs) and stay valid as long as the snapshot or
+ * store the view came from is alive.
+ */
+struct Coin {
+    std::string_view id;      // CoinGecko ID (e.g., "bitcoin")
+    std::string_view symbol;  // Trading symbol (e.g., "BTC")
+    std::string_view name;    // Display name (e.g., "Bitcoin")
+    double price = 0.0;       // Current price in USD
+    double change_24h = 0.0;  // 24-hour percentage change
+    bool in_watchlist = false; // Is this coin in user's watchlist?
+};
@@ -0,0 +1,43 @@
+#include "CoinCatalog.h"
+#include <unordered_map>
+
+CoinCatalog::CoinCatalog(const std::vector<CoinInfo>& infos) {
+    // Reserve the worst case up front so the buffer never moves while the
+    // dedupe map holds views into it
+    size_t total = 0;
+    for (const auto& info : infos) {
+        total += info.id.size() + info.symbol.size() + info.name.size() + 3;
+    }
+    strings.reserve(total);
+    entries.reserve(infos.size());
+
+    std::unordered_map<std::string_view, uint32_t> interned;
+    interned.reserve(infos.size() * 3);
+
+    auto intern = [&](const std::string& value) {
+        auto it = interned.find(value);
+        if (it != interned.end()) return it->second;
+
+        uint32_t offset = static_cast<uint32_t>(strings.size());
+        strings.insert(strings.end(), value.begin(), value.end());
+        strings.push_back('\0');
+        interned.emplace(std::string_view(strings.data() + offset, value.size()), offset);
+        return offset;
+    };
+
+    for (const auto& info : infos) {
+        Entry entry;
+        entry.id = intern(info.id);
+        entry.symbol = intern(info.symbol);
+        entry.name = intern(info.name);
+        entries.push_back(entry);
+    }
+
+    strings.shrink_to_fit();
+    index.Rebuild(*this);
+    search.Rebuild(*this);
+}
+
+size_t CoinCatalog::MemoryBytes() const {
+    return strings.capacity() + entries.capacity() * sizeof(Entry) + index.MemoryBytes() + search.MemoryBytes();
+}
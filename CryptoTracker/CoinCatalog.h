@@ -0,0 +1,65 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include "Coin.h"
+#include "CoinIndex.h"
+#include "CoinSearchIndex.h"
+
+/**
+ * @brief Immutable, interned id/symbol/name table for the tracked coins
+ *
+ * All strings live back to back (null-terminated) in one buffer and each
+ * coin references them by 32-bit offset; duplicates (e.g. symbol == name
+ * for "XRP") are stored once. The catalog also owns the CoinIndex, whose
+ * keys point into the same buffer, and the name/symbol CoinSearchIndex. Built once per coin-list change and
+ * shared by the live store and every snapshot via shared_ptr.
+ */
+class CoinCatalog {
+public:
+    /**
+     * @brief Intern the given coin descriptions
+     * @param infos Coins in storage order
+     */
+    explicit CoinCatalog(const std::vector<CoinInfo>& infos);
+
+    CoinCatalog(const CoinCatalog&) = delete;
+    CoinCatalog& operator=(const CoinCatalog&) = delete;
+
+    size_t Size() const { return entries.size(); }
+
+    std::string_view Id(size_t index) const { return Get(entries[index].id); }
+    std::string_view Symbol(size_t index) const { return Get(entries[index].symbol); }
+    std::string_view Name(size_t index) const { return Get(entries[index].name); }
+
+    /**
+     * @brief ID/symbol -> index lookup
+     */
+    const CoinIndex& Index() const { return index; }
+
+    /**
+     * @brief Name/symbol substring search
+     */
+    const CoinSearchIndex& Search() const { return search; }
+
+    /**
+     * @brief Heap bytes used by the string pool, offsets and both indexes
+     */
+    size_t MemoryBytes() const;
+
+private:
+    struct Entry {
+        uint32_t id;        // Offsets into 'strings'
+        uint32_t symbol;
+        uint32_t name;
+    };
+
+    std::string_view Get(uint32_t offset) const {
+        return std::string_view(strings.data() + offset);
+    }
+
+    std::vector<char> strings;      // Interned, null-terminated strings
+    std::vector<Entry> entries;     // One per coin
+    CoinIndex index;
+    CoinSearchIndex search;
+};
@@ -0,0 +1,24 @@
+#include "CoinIndex.h"
+#include "CoinCatalog.h"
+
+void CoinIndex::Rebuild(const CoinCatalog& catalog) {
+    by_id.clear();
+    by_symbol.clear();
+    by_id.reserve(catalog.Size());
+    by_symbol.reserve(catalog.Size());
+
+    for (size_t i = 0; i < catalog.Size(); ++i) {
+        by_id.emplace(catalog.Id(i), static_cast<uint32_t>(i));
+        auto [it, inserted] = by_symbol.emplace(catalog.Symbol(i), static_cast<uint32_t>(i));
+        if (!inserted) {
+            it->second = SHARED;    // Ambiguous: no coin answers to it
+        }
+    }
+}
+
+size_t CoinIndex::MemoryBytes() const {
+    // One node (key view + value + next pointer + cached hash) per entry plus the bucket arrays
+    const size_t node = sizeof(Map::value_type) + 2 * sizeof(void*);
+    return (by_id.size() + by_symbol.size()) * node +
+        (by_id.bucket_count() + by_symbol.bucket_count()) * sizeof(void*);
+}
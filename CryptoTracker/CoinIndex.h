@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
+class CoinCatalog;
+
+/**
+ * @brief Hash lookup from coin ID / symbol to position in the coin store
+ *
+ * Rebuilt whenever the coin list changes so that every lookup in
+ * PriceManager (watchlist edits, watchlist load, response parsing) is a
+ * single O(1) probe instead of a linear scan over string ids. Keys are
+ * views into the owning CoinCatalog's string pool, so the index adds no
+ * string copies and lookups never allocate.
+ */
+class CoinIndex {
+public:
+    static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+    /**
+     * @brief Re-index the coins of a catalog
+     * @param catalog Catalog that owns the key strings (must outlive the index)
+     */
+    void Rebuild(const CoinCatalog& catalog);
+
+    /**
+     * @brief Find a coin by CoinGecko ID
+     * @return Index into the coin store, or NOT_FOUND
+     */
+    size_t FindById(std::string_view id) const {
+        auto it = by_id.find(id);
+        return it != by_id.end() ? it->second : NOT_FOUND;
+    }
+
+    /**
+     * @brief Find a coin by trading symbol (e.g., "BTC")
+     * @return Index of the only coin with that symbol, or NOT_FOUND (also when several coins share it)
+     */
+    size_t FindBySymbol(std::string_view symbol) const {
+        auto it = by_symbol.find(symbol);
+        return it != by_symbol.end() && it->second != SHARED ? it->second : NOT_FOUND;
+    }
+
+    /**
+     * @brief Number of indexed coins
+     */
+    size_t Size() const { return by_id.size(); }
+
+    /**
+     * @brief Approximate heap bytes used by both maps
+     */
+    size_t MemoryBytes() const;
+
+private:
+    using Map = std::unordered_map<std::string_view, uint32_t>;
+    static constexpr uint32_t SHARED = UINT32_MAX;  // by_symbol value of a symbol several coins carry
+
+    Map by_id;          // CoinGecko ID -> index
+    Map by_symbol;      // Symbol -> index, or SHARED
+};
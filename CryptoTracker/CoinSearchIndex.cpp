@@ -0,0 +1,131 @@
+#include "CoinSearchIndex.h"
+#include "CoinCatalog.h"
+#include <algorithm>
+#include <cctype>
+
+namespace {
+
+char ToLower(char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+// Key of the 1..3 byte gram at p; the length tag keeps the key spaces apart
+uint32_t GramKey(const char* p, size_t length) {
+    uint32_t key = static_cast<uint32_t>(length) << 24;
+    for (size_t i = 0; i < length; ++i) {
+        key |= static_cast<uint32_t>(static_cast<unsigned char>(p[i])) << (8 * (length - 1 - i));
+    }
+    return key;
+}
+
+} // namespace
+
+void CoinSearchIndex::Rebuild(const CoinCatalog& catalog) {
+    size_t count = catalog.Size();
+
+    text.clear();
+    text_offsets.clear();
+    text_offsets.reserve(count + 1);
+    for (size_t i = 0; i < count; ++i) {
+        text_offsets.push_back(static_cast<uint32_t>(text.size()));
+        for (char c : catalog.Name(i)) text.push_back(ToLower(c));
+        text.push_back('\0');   // Keeps matches from spanning name and symbol
+        for (char c : catalog.Symbol(i)) text.push_back(ToLower(c));
+    }
+    text_offsets.push_back(static_cast<uint32_t>(text.size()));
+    text.shrink_to_fit();
+
+    // (gram, coin) pairs; sorting groups them by gram with coins ascending
+    std::vector<uint64_t> pairs;
+    pairs.reserve(text.size() * 3);
+    for (uint32_t coin = 0; coin < count; ++coin) {
+        std::string_view coin_text = Text(coin);
+        for (size_t j = 0; j < coin_text.size(); ++j) {
+            for (size_t n = 1; n <= 3 && j + n <= coin_text.size(); ++n) {
+                if (coin_text[j + n - 1] == '\0') break;
+                pairs.push_back((static_cast<uint64_t>(GramKey(coin_text.data() + j, n)) << 32) | coin);
+            }
+        }
+    }
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+    grams.clear();
+    posting_offsets.clear();
+    postings.clear();
+    postings.reserve(pairs.size());
+    for (uint64_t pair : pairs) {
+        uint32_t key = static_cast<uint32_t>(pair >> 32);
+        if (grams.empty() || grams.back() != key) {
+            grams.push_back(key);
+            posting_offsets.push_back(static_cast<uint32_t>(postings.size()));
+        }
+        postings.push_back(static_cast<uint32_t>(pair));
+    }
+    posting_offsets.push_back(static_cast<uint32_t>(postings.size()));
+    grams.shrink_to_fit();
+    posting_offsets.shrink_to_fit();
+}
+
+void CoinSearchIndex::Find(std::string_view query, std::vector<uint32_t>& out) const {
+    out.clear();
+    uint32_t count = static_cast<uint32_t>(text_offsets.empty() ? 0 : text_offsets.size() - 1);
+
+    char lowered[MAX_QUERY];
+    size_t length = std::min(query.size(), MAX_QUERY);
+    for (size_t i = 0; i < length; ++i) {
+        lowered[i] = ToLower(query[i]);
+    }
+    std::string_view needle(lowered, length);
+
+    if (needle.empty()) {
+        out.reserve(count);
+        for (uint32_t coin = 0; coin < count; ++coin) out.push_back(coin);
+        return;
+    }
+
+    // Up to three characters the gram's postings are the exact answer
+    if (needle.size() <= 3) {
+        size_t begin = 0, end = 0;
+        if (FindPostings(GramKey(needle.data(), needle.size()), begin, end)) {
+            out.assign(postings.begin() + begin, postings.begin() + end);
+        }
+        return;
+    }
+
+    // Every match contains all of the query's trigrams: verify the shortest list
+    size_t best_begin = 0, best_end = 0;
+    bool first = true;
+    for (size_t j = 0; j + 3 <= needle.size(); ++j) {
+        size_t begin = 0, end = 0;
+        if (!FindPostings(GramKey(needle.data() + j, 3), begin, end)) return;   // Trigram occurs nowhere
+
+        if (first || end - begin < best_end - best_begin) {
+            best_begin = begin;
+            best_end = end;
+            first = false;
+        }
+    }
+
+    for (size_t p = best_begin; p < best_end; ++p) {
+        uint32_t coin = postings[p];
+        if (Text(coin).find(needle) != std::string_view::npos) {
+            out.push_back(coin);
+        }
+    }
+}
+
+bool CoinSearchIndex::FindPostings(uint32_t key, size_t& begin, size_t& end) const {
+    auto it = std::lower_bound(grams.begin(), grams.end(), key);
+    if (it == grams.end() || *it != key) return false;
+
+    size_t g = static_cast<size_t>(it - grams.begin());
+    begin = posting_offsets[g];
+    end = posting_offsets[g + 1];
+    return true;
+}
+
+size_t CoinSearchIndex::MemoryBytes() const {
+    return text.capacity() + (text_offsets.capacity() + grams.capacity() +
+        posting_offsets.capacity() + postings.capacity()) * sizeof(uint32_t);
+}
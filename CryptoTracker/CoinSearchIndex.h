@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+class CoinCatalog;
+
+/**
+ * @brief Case-insensitive substring search over coin names and symbols
+ *
+ * Built once per catalog: every coin's lowercased "name\0symbol" is stored
+ * back to back in one buffer, and each distinct 1-, 2- and 3-character gram
+ * of that text maps to the sorted list of coins containing it (postings
+ * stored contiguously, CSR style). Queries of up to three characters are
+ * answered straight from their gram's list; longer ones only verify the
+ * coins on their rarest trigram's list.
+ * Queries never allocate once the caller's result vector has grown.
+ */
+class CoinSearchIndex {
+public:
+    /**
+     * @brief Index the names and symbols of a catalog
+     */
+    void Rebuild(const CoinCatalog& catalog);
+
+    /**
+     * @brief Find coins whose name or symbol contains 'query' (ASCII case-insensitive)
+     * @param query Search text; empty matches every coin
+     * @param out Receives matching coin indices in ascending order (cleared first)
+     */
+    void Find(std::string_view query, std::vector<uint32_t>& out) const;
+
+    /**
+     * @brief Approximate heap bytes used by the text buffer and postings
+     */
+    size_t MemoryBytes() const;
+
+private:
+    static constexpr size_t MAX_QUERY = 256;    // Longer queries are truncated
+
+    /**
+     * @brief Locate the postings of a gram key
+     * @return false if no coin contains the gram
+     */
+    bool FindPostings(uint32_t key, size_t& begin, size_t& end) const;
+
+    std::string_view Text(uint32_t coin) const {
+        return std::string_view(text.data() + text_offsets[coin],
+            text_offsets[coin + 1] - text_offsets[coin]);
+    }
+
+    std::vector<char> text;                     // Lowered "name\0symbol" per coin
+    std::vector<uint32_t> text_offsets;         // Coin i spans [offsets[i], offsets[i + 1])
+    std::vector<uint32_t> grams;                // Distinct gram keys, ascending
+    std::vector<uint32_t> posting_offsets;      // Postings of grams[g] span [offsets[g], offsets[g + 1])
+    std::vector<uint32_t> postings;             // Coin indices, ascending within each trigram
+};
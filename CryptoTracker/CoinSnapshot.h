@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CoinStore.h"
+
+/**
+ * @brief What a snapshot changed relative to the one published before it
+ *
+ * Consumers that hold the snapshot of 'since_version' only need to look
+ * at 'slots' (or at the watchlist, if 'watchlist' is set). Anyone further
+ * behind, or any snapshot with 'all' set, needs a full pass.
+ */
+struct CoinChanges {
+    uint64_t since_version = 0;         // Version of the previous snapshot
+    bool all = false;                   // Coin list replaced (or first snapshot): treat every coin as changed
+    bool watchlist = false;             // Watchlist membership changed
+    std::vector<uint32_t> slots;        // Coins whose price or 24h change moved, ascending
+
+    /**
+     * @brief Whether a consumer at 'seen_version' can apply 'slots' instead of rescanning
+     */
+    bool AppliesTo(uint64_t seen_version) const { return !all && seen_version == since_version; }
+};
+
+/**
+ * @brief Immutable copy of the coin data published by PriceManager
+ *
+ * A new snapshot is built after every price update or watchlist edit and
+ * published through an atomic shared_ptr. Readers (the UI) keep a pointer
+ * to the snapshot they are drawing and never lock or copy the live data;
+ * the old snapshot is freed when its last reader lets go.
+ */
+struct CoinSnapshot {
+    uint64_t version = 0;               // Increases with every publication
+    CoinStore store;                    // All tracked coins (catalog shared with the live store)
+    std::vector<size_t> watchlist;      // Indices into store of watchlist members
+    std::string last_update_time;       // Time of the last successful fetch
+    CoinChanges changes;                // Delta against the previous version
+};
@@ -0,0 +1,79 @@
+#include "CoinStore.h"
+#include <algorithm>
+#include <cmath>
+
+CoinStore::CoinStore(std::shared_ptr<const CoinCatalog> catalog)
+    : catalog(std::move(catalog)) {
+    size_t count = this->catalog->Size();
+    prices.assign(count, 0.0);
+    changes.assign(count, 0.0);
+    updated_at.assign(count, 0);
+    flags.assign(count, 0);
+}
+
+Coin CoinStore::Get(size_t index) const {
+    Coin coin;
+    coin.id = catalog->Id(index);
+    coin.symbol = catalog->Symbol(index);
+    coin.name = catalog->Name(index);
+    coin.price = prices[index];
+    coin.change_24h = changes[index];
+    coin.in_watchlist = InWatchlist(index);
+    return coin;
+}
+
+void CoinStore::SetWatchlist(size_t index, bool in_watchlist) {
+    if (in_watchlist) {
+        flags[index] |= FLAG_WATCHLIST;
+    }
+    else {
+        flags[index] &= static_cast<uint8_t>(~FLAG_WATCHLIST);
+    }
+}
+
+std::vector<size_t> CoinStore::WatchlistIndices() const {
+    std::vector<size_t> result;
+    for (size_t i = 0; i < flags.size(); ++i) {
+        if (flags[i] & FLAG_WATCHLIST) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+std::vector<size_t> CoinStore::TopMovers(size_t count) const {
+    std::vector<size_t> order;
+    order.reserve(changes.size());
+    for (size_t i = 0; i < changes.size(); ++i) {
+        if (flags[i] & FLAG_PRICED) {
+            order.push_back(i);
+        }
+    }
+
+    count = std::min(count, order.size());
+    std::partial_sort(order.begin(), order.begin() + count, order.end(),
+        [this](size_t a, size_t b) { return std::fabs(changes[a]) > std::fabs(changes[b]); });
+    order.resize(count);
+    return order;
+}
+
+CoinStats CoinStore::ComputeStats() const {
+    CoinStats stats;
+    double sum = 0.0;
+    for (size_t i = 0; i < changes.size(); ++i) {
+        if (!(flags[i] & FLAG_PRICED)) continue;
+        ++stats.priced;
+        stats.gainers += changes[i] > 0.0;
+        stats.losers += changes[i] < 0.0;
+        sum += changes[i];
+    }
+    if (stats.priced > 0) {
+        stats.mean_change_24h = sum / static_cast<double>(stats.priced);
+    }
+    return stats;
+}
+
+size_t CoinStore::ColumnBytes() const {
+    return prices.capacity() * sizeof(double) + changes.capacity() * sizeof(double) +
+        updated_at.capacity() * sizeof(int64_t) + flags.capacity();
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Coin.h"
+#include "CoinCatalog.h"
+
+/**
+ * @brief Aggregate statistics over the numeric columns
+ */
+struct CoinStats {
+    size_t priced = 0;              // Coins that have received a price
+    size_t gainers = 0;             // change_24h > 0
+    size_t losers = 0;              // change_24h < 0
+    double mean_change_24h = 0.0;   // Average change over priced coins
+};
+
+/**
+ * @brief Columnar (structure-of-arrays) storage of coin market data
+ *
+ * Prices, changes, flags and update timestamps are kept in separate
+ * contiguous arrays indexed by coin position, so scans (filtering, top
+ * movers, statistics) only stream through the numeric columns they need.
+ * Names/ids live in the shared, immutable CoinCatalog; copying a store
+ * (e.g. into a snapshot) copies only the numeric columns.
+ */
+class CoinStore {
+public:
+    static constexpr uint8_t FLAG_WATCHLIST = 1;    // Coin is in the user's watchlist
+    static constexpr uint8_t FLAG_PRICED = 2;       // At least one price was received
+
+    CoinStore() = default;
+
+    /**
+     * @brief Create empty columns for every coin of a catalog
+     */
+    explicit CoinStore(std::shared_ptr<const CoinCatalog> catalog);
+
+    size_t Size() const { return prices.size(); }
+    const CoinCatalog& Catalog() const { return *catalog; }
+    const std::shared_ptr<const CoinCatalog>& CatalogPtr() const { return catalog; }
+
+    /**
+     * @brief Assemble a Coin view of one row
+     */
+    Coin Get(size_t index) const;
+
+    double Price(size_t index) const { return prices[index]; }
+    double Change(size_t index) const { return changes[index]; }
+    int64_t UpdatedAt(size_t index) const { return updated_at[index]; }
+    bool InWatchlist(size_t index) const { return (flags[index] & FLAG_WATCHLIST) != 0; }
+    bool IsPriced(size_t index) const { return (flags[index] & FLAG_PRICED) != 0; }
+
+    void SetPrice(size_t index, double price, int64_t timestamp_ms) {
+        prices[index] = price;
+        updated_at[index] = timestamp_ms;
+        flags[index] |= FLAG_PRICED;
+    }
+    void SetChange(size_t index, double change_24h) { changes[index] = change_24h; }
+    void SetWatchlist(size_t index, bool in_watchlist);
+
+    /**
+     * @brief Indices of watchlist members in storage order (scans flags only)
+     */
+    std::vector<size_t> WatchlistIndices() const;
+
+    /**
+     * @brief Indices of the 'count' coins with the largest |change_24h|
+     */
+    std::vector<size_t> TopMovers(size_t count) const;
+
+    /**
+     * @brief Statistics over prices/changes (scans numeric columns only)
+     */
+    CoinStats ComputeStats() const;
+
+    /**
+     * @brief Heap bytes used by the numeric columns
+     */
+    size_t ColumnBytes() const;
+
+private:
+    std::shared_ptr<const CoinCatalog> catalog; // Interned strings + index (shared)
+    std::vector<double> prices;                 // USD price per coin
+    std::vector<double> changes;                // 24h change (%) per coin
+    std::vector<int64_t> updated_at;            // Time of the last price change (ms since epoch)
+    std::vector<uint8_t> flags;                 // FLAG_* bits per coin
+};
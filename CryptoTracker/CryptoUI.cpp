@@ -1,16 +1,146 @@
 #include "CryptoUI.h"
 #include <imgui.h>
 #include <algorithm>
-#include <sstream>
-#include <iomanip>
+#include <cstdio>
 #include <cstring>
+#include <ctime>
+
+namespace {
+
+/**
+ * @brief Text of a threshold or value: "$50,000.00" or "+5.00%"
+ */
+std::string FormatAlertValue(AlertField field, double value) {
+    char text[PriceFormat::PRICE_CHARS];
+    if (field == AlertField::Price) {
+        PriceFormat::FormatPrice(value, text, sizeof(text));
+    }
+    else {
+        PriceFormat::FormatChange(value, text, sizeof(text));
+    }
+    return text;
+}
+
+/**
+ * @brief "BTC price above $50,000.00"
+ */
+std::string DescribeAlert(std::string_view symbol, AlertField field, AlertDirection direction, double threshold) {
+    std::string text(symbol);
+    text += field == AlertField::Price ? " price " : " 24h change ";
+    text += direction == AlertDirection::Above ? "above " : "below ";
+    text += FormatAlertValue(field, threshold);
+    return text;
+}
+
+} // namespace
 
 CryptoUI::CryptoUI(std::shared_ptr<PriceManager> manager)
     : price_manager(manager), show_only_watchlist(false) {
     memset(search_buffer, 0, sizeof(search_buffer));
+    memset(alert_coin_buffer, 0, sizeof(alert_coin_buffer));
+}
+
+CryptoUI::DrawnState CryptoUI::CurrentState() const {
+    DrawnState state;
+    state.data_version = price_manager->GetDataVersion();
+    state.updating = price_manager->IsUpdating();
+    state.connected = price_manager->IsConnected();
+    state.streaming = price_manager->IsStreaming();
+    state.alert_version = price_manager->GetAlertVersion();
+    return state;
+}
+
+bool CryptoUI::NeedsFrame(FramePacer::Clock::time_point now) {
+    if (CurrentState() != drawn) {
+        pacer.RequestFrames();
+    }
+    return pacer.ShouldRender(now);
+}
+
+void CryptoUI::RefreshSnapshot() {
+    if (!snapshot || snapshot->version != price_manager->GetDataVersion()) {
+        snapshot = price_manager->GetSnapshot();
+        quote_text.Bind(snapshot->store.CatalogPtr());
+
+        // Rows index both by catalog position; skip sparklines until they agree
+        std::shared_ptr<const PriceHistory> history = price_manager->GetPriceHistory();
+        sparklines.Bind(history && &history->Catalog() == &snapshot->store.Catalog() ? history : nullptr);
+    }
+}
+
+void CryptoUI::RenderQuoteCells(size_t index, const Coin& coin) {
+    const QuoteText& text = quote_text.Get(index, coin.price, coin.change_24h);
+
+    // Price
+    ImGui::TableNextColumn();
+    ImGui::TextUnformatted(text.price_text);
+
+    // 24h Change (color-coded)
+    ImGui::TableNextColumn();
+    ImVec4 change_color = coin.change_24h >= 0 ?
+        ImVec4(0.0f, 1.0f, 0.0f, 1.0f) :  // Green
+        ImVec4(1.0f, 0.0f, 0.0f, 1.0f);   // Red
+    ImGui::PushStyleColor(ImGuiCol_Text, change_color);
+    ImGui::TextUnformatted(text.change_text);
+    ImGui::PopStyleColor();
+}
+
+void CryptoUI::RenderSparklineCell(size_t index) {
+    ImGui::TableNextColumn();
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImVec2 size(ImGui::GetContentRegionAvail().x, ImGui::GetTextLineHeight());
+    ImGui::Dummy(size);
+    if (!sparklines.History() || !ImGui::IsItemVisible()) return;
+
+    const Sparkline& line = sparklines.Get(index, static_cast<int>(size.x));
+    if (line.points.size() < 2) return;
+
+    spark_points.clear();
+    for (const SparkPoint& point : line.points) {
+        spark_points.push_back(ImVec2(origin.x + point.x * (size.x - 1.0f),
+            origin.y + (1.0f - point.y) * (size.y - 1.0f)));
+    }
+    ImU32 color = line.rising ?
+        IM_COL32(0, 255, 0, 255) :  // Green
+        IM_COL32(255, 0, 0, 255);   // Red
+    ImGui::GetWindowDrawList()->AddPolyline(spark_points.data(), static_cast<int>(spark_points.size()),
+        color, ImDrawFlags_None, 1.0f);
+}
+
+void CryptoUI::UpdateViewModel() {
+    bool same_filter = view.only_watchlist == show_only_watchlist && view.search == search_buffer;
+    if (view.valid && view.data_version == snapshot->version && same_filter) {
+        return;
+    }
+
+    // Rows depend on names and watchlist flags only; a delta of moved prices keeps them
+    const CoinChanges& changes = snapshot->changes;
+    if (view.valid && same_filter && changes.AppliesTo(view.data_version) && !changes.watchlist) {
+        view.data_version = snapshot->version;
+        return;
+    }
+
+    view.data_version = snapshot->version;
+    view.only_watchlist = show_only_watchlist;
+    view.search = search_buffer;
+    view.valid = true;
+
+    // Search index is built with the catalog; matches come back in table order
+    const CoinStore& store = snapshot->store;
+    store.Catalog().Search().Find(view.search, view.all_indices);
+
+    // Apply filters
+    if (show_only_watchlist) {
+        view.all_indices.erase(std::remove_if(view.all_indices.begin(), view.all_indices.end(),
+            [&](uint32_t i) { return !store.InWatchlist(i); }), view.all_indices.end());
+    }
 }
 
-void CryptoUI::Render() {
+void CryptoUI::Render(FramePacer::Clock::time_point now) {
+    drawn = CurrentState();
+    RefreshSnapshot();
+    UpdateViewModel();
+
     // Main window
     ImGui::SetNextWindowPos(ImVec2(0, 0));
     ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
@@ -27,10 +157,13 @@ void CryptoUI::Render() {
 
     // Layout: Watchlist on left, All Coins on right
     ImGui::Columns(2, "MainColumns", true);
-    ImGui::SetColumnWidth(0, 400);
+    ImGui::SetColumnWidth(0, 470);
 
     RenderWatchlist();
 
+    ImGui::Spacing();
+    RenderAlerts();
+
     ImGui::NextColumn();
 
     RenderAllCoins();
@@ -41,15 +174,17 @@ void CryptoUI::Render() {
     RenderStatusBar();
 
     ImGui::End();
+
+    // A focused text field blinks its cursor
+    pacer.FrameRendered(ImGui::GetIO().WantTextInput, now);
 }
 
 void CryptoUI::RenderWatchlist() {
     ImGui::Text("My Watchlist");
     ImGui::Separator();
 
-    // COPY watchlist data first
-    std::vector<Coin> watchlist = price_manager->GetWatchlistCoins();
-    // No lock held during rendering!
+    // Text is cached per coin; nothing is formatted or copied here
+    const std::vector<size_t>& watchlist = snapshot->watchlist;
 
     if (watchlist.empty()) {
         ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f),
@@ -58,37 +193,32 @@ void CryptoUI::RenderWatchlist() {
     }
 
     // Table for watchlist
-    if (ImGui::BeginTable("WatchlistTable", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+    if (ImGui::BeginTable("WatchlistTable", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
         ImGui::TableSetupColumn("Symbol", ImGuiTableColumnFlags_WidthFixed, 60);
         ImGui::TableSetupColumn("Price", ImGuiTableColumnFlags_WidthFixed, 100);
         ImGui::TableSetupColumn("24h Change", ImGuiTableColumnFlags_WidthFixed, 100);
+        ImGui::TableSetupColumn("Trend", ImGuiTableColumnFlags_WidthFixed, 64);
         ImGui::TableSetupColumn("Action", ImGuiTableColumnFlags_WidthFixed, 80);
         ImGui::TableHeadersRow();
 
-        for (const auto& coin : watchlist) {
+        for (size_t index : watchlist) {
+            const Coin coin = snapshot->store.Get(index);
             ImGui::TableNextRow();
 
             // Symbol
             ImGui::TableNextColumn();
-            ImGui::Text("%s", coin.symbol.c_str());
-
-            // Price
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", FormatPrice(coin.price).c_str());
+            ImGui::TextUnformatted(coin.symbol.data());
 
-            // 24h Change (color-coded)
-            ImGui::TableNextColumn();
-            ImVec4 color = coin.change_24h >= 0 ?
-                ImVec4(0.0f, 1.0f, 0.0f, 1.0f) :  // Green
-                ImVec4(1.0f, 0.0f, 0.0f, 1.0f);   // Red
-            ImGui::TextColored(color, "%s", FormatChange(coin.change_24h).c_str());
+            RenderQuoteCells(index, coin);
+            RenderSparklineCell(index);
 
             // Remove button
             ImGui::TableNextColumn();
-            std::string button_label = "Remove##" + coin.id;
-            if (ImGui::Button(button_label.c_str())) {
+            ImGui::PushID(static_cast<int>(index));
+            if (ImGui::Button("Remove")) {
                 price_manager->RemoveFromWatchlist(coin.id);
             }
+            ImGui::PopID();
         }
 
         ImGui::EndTable();
@@ -99,6 +229,122 @@ void CryptoUI::RenderWatchlist() {
     ImGui::Text("Total Coins: %d", (int)watchlist.size());
 }
 
+void CryptoUI::RefreshAlerts() {
+    uint64_t version = price_manager->GetAlertVersion();
+    if (alert_view.version == version) return;
+    alert_view.version = version;
+
+    // Symbols come from the drawn coin list; IDs it lacks are shown as they are
+    const CoinCatalog& catalog = snapshot->store.Catalog();
+    auto symbol_of = [&](const std::string& id) -> std::string_view {
+        size_t index = catalog.Index().FindById(id);
+        return index == CoinIndex::NOT_FOUND ? std::string_view(id) : catalog.Symbol(index);
+    };
+
+    alert_view.alerts = price_manager->GetAlerts();
+    alert_view.conditions.clear();
+    for (const AlertInfo& alert : alert_view.alerts) {
+        alert_view.conditions.push_back(DescribeAlert(symbol_of(alert.rule.coin_id),
+            alert.rule.field, alert.rule.direction, alert.rule.threshold));
+    }
+
+    std::vector<AlertEvent> log = price_manager->GetAlertLog();
+    alert_view.log_lines.clear();
+    for (auto it = log.rbegin(); it != log.rend(); ++it) {
+        std::time_t time = static_cast<std::time_t>(it->timestamp_ms / 1000);
+        char clock[16];
+        std::strftime(clock, sizeof(clock), "%H:%M:%S", std::localtime(&time));
+        alert_view.log_lines.push_back(std::string(clock) + "  " +
+            DescribeAlert(symbol_of(it->coin_id), it->field, it->direction, it->threshold) +
+            " (" + FormatAlertValue(it->field, it->value) + ")");
+    }
+}
+
+void CryptoUI::RenderAlerts() {
+    ImGui::Text("Price Alerts");
+    ImGui::Separator();
+
+    // New alert: coin, field, side, threshold
+    ImGui::SetNextItemWidth(110);
+    ImGui::InputTextWithHint("##AlertCoin", "coin id", alert_coin_buffer, sizeof(alert_coin_buffer));
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(80);
+    ImGui::Combo("##AlertField", &alert_field, "Price\0" "24h %\0");
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(70);
+    ImGui::Combo("##AlertSide", &alert_direction, "above\0" "below\0");
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(90);
+    ImGui::InputDouble("##AlertThreshold", &alert_threshold, 0.0, 0.0, "%.6g");
+    ImGui::SameLine();
+    if (ImGui::Button("Add Alert")) {
+        AlertRule rule;
+        rule.coin_id = alert_coin_buffer;
+        rule.field = static_cast<AlertField>(alert_field);
+        rule.direction = static_cast<AlertDirection>(alert_direction);
+        rule.threshold = alert_threshold;
+        alert_rejected = price_manager->AddAlert(rule) == 0;
+    }
+    if (alert_rejected) {
+        ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "Unknown coin ID");
+    }
+
+    RefreshAlerts();
+
+    // Active alerts; armed ones trigger on the next crossing
+    if (!alert_view.alerts.empty() && ImGui::BeginTable("AlertsTable", 3,
+        ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY, ImVec2(0, 120))) {
+        ImGui::TableSetupColumn("Condition", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("State", ImGuiTableColumnFlags_WidthFixed, 70);
+        ImGui::TableSetupColumn("Action", ImGuiTableColumnFlags_WidthFixed, 70);
+        ImGui::TableHeadersRow();
+
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(alert_view.alerts.size()));
+        while (clipper.Step()) {
+            for (int r = clipper.DisplayStart; r < clipper.DisplayEnd; ++r) {
+                const AlertInfo& alert = alert_view.alerts[r];
+                ImGui::TableNextRow();
+
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(alert_view.conditions[r].c_str());
+
+                ImGui::TableNextColumn();
+                if (!alert.active) {
+                    ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f), "untracked");
+                }
+                else {
+                    ImGui::TextUnformatted(alert.armed ? "armed" : "waiting");
+                }
+
+                ImGui::TableNextColumn();
+                ImGui::PushID(static_cast<int>(alert.id));
+                if (ImGui::Button("Remove")) {
+                    price_manager->RemoveAlert(alert.id);
+                }
+                ImGui::PopID();
+            }
+        }
+        ImGui::EndTable();
+    }
+
+    // Triggered alerts, newest first
+    ImGui::Text("Alert Log");
+    if (ImGui::BeginChild("AlertLog", ImVec2(0, 120), ImGuiChildFlags_Borders)) {
+        if (alert_view.log_lines.empty()) {
+            ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f), "No alerts triggered yet.");
+        }
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(alert_view.log_lines.size()));
+        while (clipper.Step()) {
+            for (int r = clipper.DisplayStart; r < clipper.DisplayEnd; ++r) {
+                ImGui::TextUnformatted(alert_view.log_lines[r].c_str());
+            }
+        }
+    }
+    ImGui::EndChild();
+}
+
 void CryptoUI::RenderAllCoins() {
     ImGui::Text("All Cryptocurrencies");
     ImGui::Separator();
@@ -111,22 +357,21 @@ void CryptoUI::RenderAllCoins() {
     ImGui::Checkbox("Show only watchlist", &show_only_watchlist);
     ImGui::SameLine();
 
-    if (ImGui::Button("Refresh Now")) {
+    // Hands the fetch to the update thread; never blocks the frame
+    bool updating = price_manager->IsUpdating();
+    ImGui::BeginDisabled(updating);
+    if (ImGui::Button(updating ? "Updating...###Refresh" : "Refresh Now###Refresh")) {
         price_manager->UpdatePrices();
     }
+    ImGui::EndDisabled();
 
     ImGui::Separator();
 
-    // COPY coin data before rendering - don't hold lock during UI interaction
-    std::vector<Coin> coins_copy;
-    {
-        std::lock_guard<std::mutex> lock(price_manager->GetMutex());
-        coins_copy = price_manager->GetCoins();
-    }
-    // Lock is released here!
+    // Search text or filter may have changed above
+    UpdateViewModel();
 
     // Table for all coins
-    if (ImGui::BeginTable("AllCoinsTable", 5,
+    if (ImGui::BeginTable("AllCoinsTable", 6,
         ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
         ImGuiTableFlags_ScrollY, ImVec2(0, 400))) {
 
@@ -134,64 +379,42 @@ void CryptoUI::RenderAllCoins() {
         ImGui::TableSetupColumn("Symbol", ImGuiTableColumnFlags_WidthFixed, 70);
         ImGui::TableSetupColumn("Price", ImGuiTableColumnFlags_WidthFixed, 100);
         ImGui::TableSetupColumn("24h Change", ImGuiTableColumnFlags_WidthFixed, 100);
+        ImGui::TableSetupColumn("Trend", ImGuiTableColumnFlags_WidthFixed, 80);
         ImGui::TableSetupColumn("Action", ImGuiTableColumnFlags_WidthFixed, 80);
         ImGui::TableHeadersRow();
 
-        std::string search_term(search_buffer);
-        std::transform(search_term.begin(), search_term.end(), search_term.begin(), ::tolower);
-
-        for (const auto& coin : coins_copy) {  // Use the copy, not the reference!
-            // Apply filters
-            if (show_only_watchlist && !coin.in_watchlist) {
-                continue;
-            }
-
-            if (!search_term.empty()) {
-                std::string name_lower = coin.name;
-                std::string symbol_lower = coin.symbol;
-                std::transform(name_lower.begin(), name_lower.end(), name_lower.begin(), ::tolower);
-                std::transform(symbol_lower.begin(), symbol_lower.end(), symbol_lower.begin(), ::tolower);
-
-                if (name_lower.find(search_term) == std::string::npos &&
-                    symbol_lower.find(search_term) == std::string::npos) {
-                    continue;
-                }
-            }
-
-            ImGui::TableNextRow();
-
-            // Name
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", coin.name.c_str());
-
-            // Symbol
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", coin.symbol.c_str());
-
-            // Price
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", FormatPrice(coin.price).c_str());
-
-            // 24h Change (color-coded)
-            ImGui::TableNextColumn();
-            ImVec4 color = coin.change_24h >= 0 ?
-                ImVec4(0.0f, 1.0f, 0.0f, 1.0f) :  // Green
-                ImVec4(1.0f, 0.0f, 0.0f, 1.0f);   // Red
-            ImGui::TextColored(color, "%s", FormatChange(coin.change_24h).c_str());
-
-            // Add/Remove button - NO LOCK HELD HERE!
-            ImGui::TableNextColumn();
-            if (coin.in_watchlist) {
-                std::string button_label = "Remove##" + coin.id;
-                if (ImGui::Button(button_label.c_str())) {
-                    price_manager->RemoveFromWatchlist(coin.id);
-                }
-            }
-            else {
-                std::string button_label = "Add##" + coin.id;
-                if (ImGui::Button(button_label.c_str())) {
-                    price_manager->AddToWatchlist(coin.id);
+        // Only the rows inside the scroll region are submitted (and formatted)
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(view.all_indices.size()));
+        while (clipper.Step()) {
+            for (int r = clipper.DisplayStart; r < clipper.DisplayEnd; ++r) {
+                const uint32_t index = view.all_indices[r];
+                const Coin coin = snapshot->store.Get(index);
+                ImGui::TableNextRow();
+
+                // Name
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(coin.name.data());
+
+                // Symbol
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(coin.symbol.data());
+
+                RenderQuoteCells(index, coin);
+                RenderSparklineCell(index);
+
+                // Add/Remove button
+                ImGui::TableNextColumn();
+                ImGui::PushID(static_cast<int>(index));
+                if (ImGui::Button(coin.in_watchlist ? "Remove" : "Add")) {
+                    if (coin.in_watchlist) {
+                        price_manager->RemoveFromWatchlist(coin.id);
+                    }
+                    else {
+                        price_manager->AddToWatchlist(coin.id);
+                    }
                 }
+                ImGui::PopID();
             }
         }
 
@@ -210,25 +433,22 @@ void CryptoUI::RenderStatusBar() {
     ImGui::SameLine();
     ImGui::Text("|");
     ImGui::SameLine();
-    ImGui::Text("Last Update: %s", price_manager->GetLastUpdateTime().c_str());
+    ImGui::Text("Last Update: %s", snapshot->last_update_time.c_str());
     ImGui::SameLine();
     ImGui::Text("|");
     ImGui::SameLine();
-    ImGui::Text("Auto-refresh: 30s");
-}
-
-std::string CryptoUI::FormatPrice(double price) {
-    std::stringstream ss;
-    ss << std::fixed << std::setprecision(2) << "$" << price;
-    return ss.str();
-}
-
-std::string CryptoUI::FormatChange(double change) {
-    std::stringstream ss;
-    ss << std::fixed << std::setprecision(2);
-    if (change >= 0) {
-        ss << "+";
+    if (price_manager->IsStreaming()) {
+        ImGui::TextUnformatted("Live stream");
     }
-    ss << change << "%";
-    return ss.str();
-}
\ No newline at end of file
+    else if (price_manager->GetRefreshPolicy().adaptive) {
+        // Each coin has its own interval within the policy's range
+        const RefreshPolicy& policy = price_manager->GetRefreshPolicy();
+        ImGui::Text("Auto-refresh: %lld-%llds",
+            static_cast<long long>(policy.min_interval.count() / 1000),
+            static_cast<long long>(policy.max_interval.count() / 1000));
+    }
+    else {
+        ImGui::Text("Auto-refresh: %llds",
+            static_cast<long long>(price_manager->GetUpdateInterval().count() / 1000));
+    }
+}
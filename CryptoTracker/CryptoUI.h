@@ -1,6 +1,12 @@
 #pragma once
 #include "PriceManager.h"
+#include "PriceFormat.h"
+#include "Sparkline.h"
+#include "FramePacer.h"
+#include <imgui.h>
 #include <memory>
+#include <string>
+#include <vector>
 
 /**
  * @brief Handles the ImGui user interface for the crypto tracker
@@ -10,7 +16,23 @@
  * - Watchlist display with add/remove functionality
  * - All coins table with search and filter
  * - Color-coded price changes (green=up, red=down)
+ * - Per-row sparklines of recent price history
+ * - Price/change alerts and the log of triggered alerts
  * - Connection status indicator
+ *
+ * Coin data is read from the PriceManager's published CoinSnapshot: the UI
+ * keeps a pointer to the snapshot it draws and swaps it only when the
+ * snapshot version changes, so frames neither lock nor copy coin data.
+ * The filtered row list is cached in a view model and rebuilt only when the
+ * coin list, watchlist, search text or watchlist filter changes (snapshots
+ * that only moved prices carry a change set saying so); price/change text
+ * is cached per coin and re-formatted only when that coin's values change.
+ * Sparklines are LTTB-downsampled to the cell width and cached per coin
+ * until that coin receives new ticks. Alert rows and log lines are re-read
+ * and formatted only when the manager's alert version changes.
+ *
+ * For render-on-demand loops, NeedsFrame()/IdleTimeout() tell the caller
+ * whether anything visible can have changed since the last frame.
  */
 class CryptoUI {
 public:
@@ -22,40 +44,136 @@ public:
 
     /**
      * @brief Render the entire UI (called every frame)
+     * @param now Frame time used for on-demand pacing
+     */
+    void Render(FramePacer::Clock::time_point now = FramePacer::Clock::now());
+
+    /**
+     * @brief Note that platform input arrived (mouse, keyboard, resize, ...)
+     */
+    void OnInputEvent() { pacer.RequestFrames(); }
+
+    /**
+     * @brief Whether a frame has to be rendered now
+     *
+     * True for a few frames after input, when the data version or the
+     * updating/connection status differs from what was last drawn, and
+     * periodically while a widget animates (text cursor).
+     */
+    bool NeedsFrame(FramePacer::Clock::time_point now = FramePacer::Clock::now());
+
+    /**
+     * @brief Longest the loop may block waiting for input or a data signal
+     * @return Clock::duration::max() when only an event can require a frame
+     */
+    FramePacer::Clock::duration IdleTimeout(FramePacer::Clock::time_point now = FramePacer::Clock::now()) const {
+        return pacer.TimeUntilNextFrame(now);
+    }
+
+    /**
+     * @brief Frames rendered so far
      */
-    void Render();
+    uint64_t FramesRendered() const { return pacer.FramesRendered(); }
 
 private:
+    /**
+     * @brief Derived rows plus the inputs they were built from
+     */
+    struct ViewModel {
+        uint64_t data_version = 0;      // Snapshot version the rows reflect
+        std::string search;             // Search text the rows were filtered with
+        bool only_watchlist = false;    // Filter flag the rows were filtered with
+        bool valid = false;             // False until first build
+        std::vector<uint32_t> all_indices;  // Filtered rows of the all-coins table
+    };
+
+    /**
+     * @brief Alerts and formatted log lines as of an alert version
+     */
+    struct AlertView {
+        uint64_t version = ~0ull;       // Alert version the lists reflect
+        std::vector<AlertInfo> alerts;
+        std::vector<std::string> conditions;    // "BTC price above $50,000.00", per alert
+        std::vector<std::string> log_lines;     // Newest first
+    };
+
+    /**
+     * @brief Manager state a frame was drawn from
+     */
+    struct DrawnState {
+        uint64_t data_version = 0;
+        bool updating = false;
+        bool connected = false;
+        bool streaming = false;
+        uint64_t alert_version = 0;
+
+        bool operator==(const DrawnState&) const = default;
+    };
+
+    /**
+     * @brief Read the manager state that affects what is drawn
+     */
+    DrawnState CurrentState() const;
+
+    /**
+     * @brief Pick up a newer snapshot if one was published
+     */
+    void RefreshSnapshot();
+
+    /**
+     * @brief Rebuild the view model if its inputs changed
+     */
+    void UpdateViewModel();
+
+    /**
+     * @brief Draw the price and colored 24h change cells of a coin's row
+     */
+    void RenderQuoteCells(size_t index, const Coin& coin);
+
+    /**
+     * @brief Draw the sparkline cell of a coin's row
+     */
+    void RenderSparklineCell(size_t index);
+
     /**
      * @brief Render the watchlist section
      */
     void RenderWatchlist();
 
     /**
-     * @brief Render the all coins table with search
+     * @brief Re-read the alerts if their version changed
      */
-    void RenderAllCoins();
+    void RefreshAlerts();
 
     /**
-     * @brief Render the status bar at the bottom
+     * @brief Render the alert form, the alert list and the alert log
      */
-    void RenderStatusBar();
+    void RenderAlerts();
 
     /**
-     * @brief Helper to format price with proper decimals
-     * @param price The price value
-     * @return Formatted string
+     * @brief Render the all coins table with search
      */
-    std::string FormatPrice(double price);
+    void RenderAllCoins();
 
     /**
-     * @brief Helper to format percentage change
-     * @param change The change value
-     * @return Formatted string with sign
+     * @brief Render the status bar at the bottom
      */
-    std::string FormatChange(double change);
+    void RenderStatusBar();
 
     std::shared_ptr<PriceManager> price_manager;
+    std::shared_ptr<const CoinSnapshot> snapshot;   // Data drawn this frame (immutable)
+    ViewModel view;                                 // Cached rows derived from snapshot
+    QuoteTextCache quote_text;                      // Formatted price/change per coin
+    SparklineCache sparklines;                      // Downsampled history per coin
+    std::vector<ImVec2> spark_points;               // Scratch: one sparkline in screen space
+    FramePacer pacer;                               // On-demand frame decisions
+    DrawnState drawn;                               // State of the last rendered frame
+    AlertView alert_view;                           // Cached alert rows and log text
     char search_buffer[256];                // Buffer for search input
     bool show_only_watchlist;               // Filter flag
+    char alert_coin_buffer[128];            // Coin ID of a new alert
+    int alert_field = 0;                    // AlertField of a new alert
+    int alert_direction = 0;                // AlertDirection of a new alert
+    double alert_threshold = 0.0;           // Threshold of a new alert
+    bool alert_rejected = false;            // Last Add Alert named an unknown coin
 };
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "FetchPlanner.h"
+#include <algorithm>
+
+namespace {
+
+const std::string PATH_PREFIX = "/api/v3/simple/price?ids=";
+const std::string PATH_SUFFIX = "&vs_currencies=usd&include_24hr_change=true";
+
+} // namespace
+
+std::vector<PriceBatch> FetchPlanner::Plan(const CoinCatalog& catalog, const std::vector<uint32_t>& due,
+    size_t max_path_length) {
+    std::vector<PriceBatch> batches;
+
+    auto close = [&](PriceBatch& batch) {
+        batch.path += PATH_SUFFIX;
+        std::sort(batch.slots.begin(), batch.slots.end());     // For the parser's membership test
+        batches.push_back(std::move(batch));
+    };
+
+    PriceBatch current;
+    current.path = PATH_PREFIX;
+
+    for (uint32_t slot : due) {
+        std::string_view id = catalog.Id(slot);
+        bool empty = current.slots.empty();
+        size_t needed = current.path.size() + (empty ? 0 : 1) + id.size() + PATH_SUFFIX.size();
+
+        // Close the batch if this id does not fit (a batch always gets at least one id)
+        if (!empty && needed > max_path_length) {
+            close(current);
+
+            current = PriceBatch();
+            current.path = PATH_PREFIX;
+            empty = true;
+        }
+
+        if (!empty) current.path += ",";
+        current.path += id;
+        current.slots.push_back(slot);
+    }
+
+    if (!current.slots.empty()) {
+        close(current);
+    }
+
+    return batches;
+}
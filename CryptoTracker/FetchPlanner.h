@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CoinCatalog.h"
+
+/**
+ * @brief One /simple/price request covering a set of coins
+ */
+struct PriceBatch {
+    std::string path;               // Request path including ids query
+    std::vector<uint32_t> slots;    // Coin indices in this batch, sorted
+};
+
+/**
+ * @brief Packs the coins due for a refresh into URL-length-bounded requests
+ *
+ * CoinGecko (and most proxies) reject very long request lines, so instead
+ * of packing every id into one URL the planner walks the due coins in
+ * priority order and starts a new batch whenever the next id would push
+ * the path over the limit. Batches are independent and can be fetched
+ * concurrently; earlier batches hold the more urgent coins, so a fetch cut
+ * short by the request budget drops the least overdue ones.
+ */
+class FetchPlanner {
+public:
+    /**
+     * @brief Build the batch list for the coins due now
+     * @param catalog Tracked coins in storage order
+     * @param due Coin indices to fetch, most urgent first
+     * @param max_path_length Upper bound on each request path (bytes)
+     * @return Batches covering every due coin exactly once, most urgent first
+     */
+    static std::vector<PriceBatch> Plan(const CoinCatalog& catalog, const std::vector<uint32_t>& due,
+        size_t max_path_length);
+};
@@ -0,0 +1,36 @@
+#include "FramePacer.h"
+#include <algorithm>
+
+FramePacer::FramePacer(int settle_frames, std::chrono::milliseconds animation_interval)
+    : settle_frames(settle_frames), animation_interval(animation_interval),
+      pending_frames(settle_frames) {   // Draw the first frames unconditionally
+}
+
+void FramePacer::RequestFrames() {
+    pending_frames = std::max(pending_frames, settle_frames);
+}
+
+bool FramePacer::ShouldRender(Clock::time_point now) const {
+    return pending_frames > 0 || (animating && now >= next_animation_frame);
+}
+
+void FramePacer::FrameRendered(bool animating, Clock::time_point now) {
+    if (pending_frames > 0) {
+        --pending_frames;
+    }
+    this->animating = animating;
+    if (animating) {
+        next_animation_frame = now + animation_interval;
+    }
+    ++frames_rendered;
+}
+
+FramePacer::Clock::duration FramePacer::TimeUntilNextFrame(Clock::time_point now) const {
+    if (ShouldRender(now)) {
+        return Clock::duration::zero();
+    }
+    if (animating) {
+        return next_animation_frame - now;
+    }
+    return Clock::duration::max();
+}
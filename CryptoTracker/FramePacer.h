@@ -0,0 +1,68 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Decides when an on-demand UI loop has to render a frame
+ *
+ * Instead of rendering at vsync forever, the main loop asks ShouldRender()
+ * and otherwise blocks (waiting for input or a data-change signal) for at
+ * most TimeUntilNextFrame(). Any event schedules a few "settle" frames,
+ * since ImGui needs a frame or two after input to update hover/active
+ * state; while the UI animates (e.g. a blinking text cursor) frames are
+ * paced at animation_interval. Platform independent and driven by an
+ * explicit clock so it can be simulated headless.
+ */
+class FramePacer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param settle_frames Frames rendered after each event
+     * @param animation_interval Frame spacing while the UI reports animation
+     */
+    explicit FramePacer(int settle_frames = 3,
+        std::chrono::milliseconds animation_interval = std::chrono::milliseconds(250));
+
+    /**
+     * @brief Something changed (input, new data, status): render soon
+     */
+    void RequestFrames();
+
+    /**
+     * @brief Whether a frame should be rendered now
+     */
+    bool ShouldRender(Clock::time_point now) const;
+
+    /**
+     * @brief Record a rendered frame
+     * @param animating UI wants periodic frames even without events
+     * @param now Time the frame was rendered
+     */
+    void FrameRendered(bool animating, Clock::time_point now);
+
+    /**
+     * @brief Longest the loop may block before the next frame is due
+     * @return Zero if a frame is due now; Clock::duration::max() if only an
+     *         event can make one necessary
+     */
+    Clock::duration TimeUntilNextFrame(Clock::time_point now) const;
+
+    /**
+     * @brief Frames recorded through FrameRendered()
+     */
+    uint64_t FramesRendered() const { return frames_rendered; }
+
+    /**
+     * @brief Frames granted per event
+     */
+    int SettleFrames() const { return settle_frames; }
+
+private:
+    int settle_frames;                          // Frames granted per event
+    std::chrono::milliseconds animation_interval; // Spacing of animation frames
+    int pending_frames;                         // Settle frames still owed
+    bool animating = false;                     // Last frame reported animation
+    Clock::time_point next_animation_frame;     // When the next animation frame is due
+    uint64_t frames_rendered = 0;
+};
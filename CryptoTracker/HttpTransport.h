@@ -0,0 +1,188 @@
+#pragma once
+#include <string>
+#include <cstdint>
+#include <memory>
+#include <chrono>
+#include <functional>
+#include <string_view>
+#include "ResponseBuffer.h"
+
+/**
+ * @brief Host and port of an HTTP server
+ */
+struct HttpEndpoint {
+    std::string host;         // Server host name or address (e.g., "api.coingecko.com")
+    uint16_t port = 80;       // TCP port
+    bool secure = false;      // TLS (WinHttpTransport only; PosixHttpTransport speaks plain TCP)
+};
+
+/**
+ * @brief Connection counters of an HttpTransport
+ *
+ * The connection counts are of TCP sockets. WinHTTP pools its sockets
+ * internally, so WinHttpTransport tells them apart by their local address
+ * and port; requests whose socket it could not identify count in neither.
+ */
+struct TransportStats {
+    uint64_t requests = 0;              // Requests issued
+    uint64_t connections_opened = 0;    // New TCP connections (DNS + handshake paid)
+    uint64_t connections_reused = 0;    // Requests served on a pooled keep-alive connection
+};
+
+/**
+ * @brief Pull interface over a response body that is still being received
+ *
+ * Handed to a BodyConsumer while the request is in flight so the body can
+ * be parsed chunk by chunk as it arrives instead of after the download.
+ */
+class BodyStream {
+public:
+    virtual ~BodyStream() = default;
+
+    /**
+     * @brief Wait for and return the next chunk of the body
+     * @return View of the newly received bytes inside the ResponseBuffer,
+     *         or an empty view at end of body / on error. The view is only
+     *         valid until the next call (the buffer may grow).
+     */
+    virtual std::string_view Next() = 0;
+
+    /**
+     * @brief HTTP status code of the response (e.g., 200, 429)
+     */
+    virtual int Status() const = 0;
+
+    /**
+     * @brief Look up a response header
+     * @param name Header name, matched case-insensitively
+     * @return Value of the first match with spaces trimmed, or an empty view if absent
+     */
+    virtual std::string_view Header(std::string_view name) const = 0;
+};
+
+/**
+ * @brief Callback that consumes a response body while it downloads
+ */
+using BodyConsumer = std::function<void(BodyStream&)>;
+
+/**
+ * @brief Client side of an open WebSocket connection
+ *
+ * Returned by HttpTransport::OpenWebSocket. Pings are answered and
+ * fragmented messages reassembled inside Receive(), so the caller only
+ * sees whole text/binary messages. Owned and used by one thread; the
+ * connection is closed on destruction, and HttpTransport::CancelAll()
+ * aborts a blocked Receive() like any other request.
+ */
+class WebSocket {
+public:
+    /**
+     * @brief Outcome of WebSocket::Receive
+     */
+    enum class Status {
+        Message,    // 'message' holds one complete message
+        Timeout,    // Nothing arrived within the timeout
+        Closed      // Closed by the server, cancelled or failed
+    };
+
+    virtual ~WebSocket() = default;
+
+    /**
+     * @brief Send one text message
+     * @return false if the connection failed
+     */
+    virtual bool SendText(std::string_view text) = 0;
+
+    /**
+     * @brief Wait for the next complete message
+     * @param message Cleared, then receives the payload (allocation is reused)
+     * @param timeout Longest time to wait; zero only returns what is already buffered
+     */
+    virtual Status Receive(ResponseBuffer& message, std::chrono::milliseconds timeout) = 0;
+};
+
+/**
+ * @brief Abstract HTTP client used by PriceManager
+ *
+ * Decouples the price pipeline from the platform HTTP stack so that the
+ * data core can run headless (benchmarks, Linux builds) against any server.
+ * Implementations are long-lived, thread-safe and keep persistent
+ * connections per host so repeated polls skip DNS and TCP/TLS handshakes.
+ * Implementations:
+ * - WinHttpTransport on Windows
+ * - PosixHttpTransport on Linux/macOS
+ */
+class HttpTransport {
+public:
+    virtual ~HttpTransport() = default;
+
+    /**
+     * @brief Perform an HTTP GET request
+     * @param endpoint Server to connect to
+     * @param path Request path including query string
+     * @param body Cleared, then receives the response body (allocation is reused)
+     * @return true if a complete response was received
+     */
+    bool Get(const HttpEndpoint& endpoint, const std::string& path, ResponseBuffer& body) {
+        return GetStreaming(endpoint, path, body, [](BodyStream&) {});
+    }
+
+    /**
+     * @brief Perform an HTTP GET request, streaming the body to a consumer
+     * @param endpoint Server to connect to
+     * @param path Request path including query string
+     * @param body Cleared, then receives the response body as it arrives
+     * @param consume Called once response headers are in; pulls chunks with
+     *        BodyStream::Next(). Whatever it leaves unread is drained afterwards.
+     * @return true if a complete response was received
+     */
+    virtual bool GetStreaming(const HttpEndpoint& endpoint, const std::string& path,
+        ResponseBuffer& body, const BodyConsumer& consume) = 0;
+
+    /**
+     * @brief Open a WebSocket connection (HTTP/1.1 upgrade)
+     * @param endpoint Server to connect to
+     * @param path Request path of the stream (e.g., "/ws/!ticker@arr")
+     * @return Open connection, or nullptr if the handshake failed
+     */
+    virtual std::unique_ptr<WebSocket> OpenWebSocket(const HttpEndpoint& endpoint, const std::string& path) = 0;
+
+    /**
+     * @brief Abort every request currently in flight
+     *
+     * Blocked sends/receives fail promptly and the affected calls return
+     * false; open WebSockets are closed. Requests started afterwards are
+     * unaffected. Used for bounded
+     * shutdown. Name resolution and connection setup may still run to
+     * completion before the abort is noticed.
+     */
+    virtual void CancelAll() = 0;
+
+    /**
+     * @brief Get connection reuse counters
+     * @return Snapshot of the counters since construction
+     */
+    virtual TransportStats GetStats() const = 0;
+};
+
+/**
+ * @brief Find a header in a raw "Name: value\r\n" block (helper for BodyStream::Header)
+ * @return Value of the first match with spaces trimmed, or an empty view if absent
+ */
+std::string_view FindHttpHeader(std::string_view head, std::string_view name);
+
+/**
+ * @brief Padded Base64 (RFC 4648) of a byte string
+ */
+std::string Base64(const unsigned char* data, size_t size);
+
+/**
+ * @brief Sec-WebSocket-Accept value that answers a Sec-WebSocket-Key (RFC 6455)
+ */
+std::string WebSocketAccept(std::string_view key);
+
+/**
+ * @brief Create the native transport for the current platform
+ * @return WinHttpTransport on Windows, PosixHttpTransport elsewhere
+ */
+std::unique_ptr<HttpTransport> CreateDefaultTransport();
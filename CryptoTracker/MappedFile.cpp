@@ -0,0 +1,66 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+std::shared_ptr<const MappedFile> MappedFile::Open(const std::filesystem::path& path, size_t length) {
+    if (length == 0) {
+        return nullptr;
+    }
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+
+    ULARGE_INTEGER map_size;
+    map_size.QuadPart = length;
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY,
+        map_size.HighPart, map_size.LowPart, nullptr);
+    CloseHandle(file);      // The mapping keeps the file open
+    if (mapping == nullptr) {
+        return nullptr;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, length);
+    CloseHandle(mapping);   // The view keeps the mapping alive
+    if (view == nullptr) {
+        return nullptr;
+    }
+#else
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    void* view = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);              // The mapping keeps the file open
+    if (view == MAP_FAILED) {
+        return nullptr;
+    }
+#endif
+
+    std::shared_ptr<MappedFile> mapped(new MappedFile());
+    mapped->data = static_cast<const char*>(view);
+    mapped->size = length;
+    return mapped;
+}
+
+MappedFile::~MappedFile() {
+    if (data == nullptr) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<char*>(data), size);
+#endif
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+
+/**
+ * @brief Read-only memory mapping of (a prefix of) a file
+ *
+ * mmap on POSIX, CreateFileMapping/MapViewOfFile on Windows. The mapping
+ * shares the page cache with writers of the same file, so bytes appended
+ * and written before Open() are visible without copying. Unmapped on
+ * destruction.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Map the first 'length' bytes of a file
+     * @param path File to map (opened read-only, sharing writes and deletes)
+     * @param length Bytes to map; must not exceed the current file size
+     * @return nullptr if the file cannot be opened or mapped
+     */
+    static std::shared_ptr<const MappedFile> Open(const std::filesystem::path& path, size_t length);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* Data() const { return data; }
+    size_t Size() const { return size; }
+
+private:
+    MappedFile() = default;
+
+    const char* data = nullptr;     // Start of the view
+    size_t size = 0;                // Mapped bytes
+};
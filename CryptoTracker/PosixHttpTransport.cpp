@@ -0,0 +1,681 @@
+#ifndef _WIN32
+#include "PosixHttpTransport.h"
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cstring>
+#include <cstdlib>
+#include <strings.h>
+#include <fcntl.h>
+#include <cerrno>
+#include <algorithm>
+#include <random>
+
+namespace {
+
+constexpr size_t MAX_BODY = 256 * 1024 * 1024;      // Larger responses fail the request
+constexpr size_t MAX_HEADERS = 64 * 1024;           // Larger header blocks fail the request
+
+// poll() timeout; 0 means no limit
+int TimeoutMs(std::chrono::milliseconds timeout) {
+    return timeout.count() > 0 ? static_cast<int>(std::min<long long>(timeout.count(), 0x7FFFFFFF)) : -1;
+}
+
+/**
+ * @brief Connect without blocking longer than 'timeout'
+ */
+bool ConnectWithin(int fd, const sockaddr* address, socklen_t length, std::chrono::milliseconds timeout) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) return false;
+
+    bool connected = connect(fd, address, length) == 0;
+    if (!connected && errno == EINPROGRESS) {
+        pollfd waiter{ fd, POLLOUT, 0 };
+        int error = 0;
+        socklen_t error_length = sizeof(error);
+        connected = poll(&waiter, 1, TimeoutMs(timeout)) == 1
+            && getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &error_length) == 0
+            && error == 0;
+    }
+    return connected && fcntl(fd, F_SETFL, flags) == 0;
+}
+
+// Helper function to open a TCP connection to the given endpoint; send() and
+// recv() on it fail once they wait longer than 'timeout'
+int ConnectTo(const HttpEndpoint& endpoint, std::chrono::milliseconds timeout) {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo* result = nullptr;
+    std::string port = std::to_string(endpoint.port);
+    if (getaddrinfo(endpoint.host.c_str(), port.c_str(), &hints, &result) != 0) {
+        return -1;
+    }
+
+    int fd = -1;
+    for (addrinfo* ai = result; ai != nullptr; ai = ai->ai_next) {
+        fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd < 0) continue;
+        if (ConnectWithin(fd, ai->ai_addr, ai->ai_addrlen, timeout)) break;
+        close(fd);
+        fd = -1;
+    }
+
+    freeaddrinfo(result);
+
+    if (fd >= 0) {
+        int yes = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+
+        timeval limit{};
+        limit.tv_sec = static_cast<time_t>(timeout.count() / 1000);
+        limit.tv_usec = static_cast<suseconds_t>(timeout.count() % 1000 * 1000);
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &limit, sizeof(limit));
+        setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &limit, sizeof(limit));
+    }
+    return fd;
+}
+
+bool SendAll(int fd, const std::string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        sent += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+/**
+ * @brief BodyStream over one HTTP/1.1 response on a socket
+ *
+ * ReadHeaders() parses the header block in place; Next() then recv()s the
+ * body straight into the ResponseBuffer one chunk at a time. A chunked body
+ * is received into a side buffer and only its data bytes are copied into
+ * the ResponseBuffer, so consumers see the same bytes either way.
+ */
+class SocketBodyStream : public BodyStream {
+public:
+    SocketBodyStream(int fd, ResponseBuffer& body) : fd(fd), body(body) {}
+
+    /**
+     * @brief Receive and parse the status line and headers
+     * @return false if the connection failed before headers were complete
+     */
+    bool ReadHeaders() {
+        body.Clear();
+
+        size_t header_end = std::string_view::npos;
+        while (header_end == std::string_view::npos) {
+            if (body.Size() > MAX_HEADERS) return false;
+            ssize_t n = recv(fd, body.PrepareWrite(READ_CHUNK), READ_CHUNK, 0);
+            if (n <= 0) return false;
+            body.CommitWrite(static_cast<size_t>(n));
+            header_end = body.View().find("\r\n\r\n");
+        }
+
+        // Keep the header block for Header(); only a few hundred bytes
+        head.assign(body.View().data(), header_end);
+        if (head.size() > 12 && head.compare(0, 5, "HTTP/") == 0) {
+            status = std::atoi(head.c_str() + head.find(' ') + 1);
+        }
+
+        size_t pos = head.find("\r\n") + 2;
+        while (pos < head.size()) {
+            size_t eol = head.find("\r\n", pos);
+            if (eol == std::string::npos) eol = head.size();
+            const char* line = head.data() + pos;
+            if (strncasecmp(line, "Content-Length:", 15) == 0) {
+                char* end = nullptr;
+                unsigned long long length = std::strtoull(line + 15, &end, 10);
+                content_length = end != line + 15 ? static_cast<size_t>(std::min<unsigned long long>(length, SIZE_MAX - 1)) : 0;
+            }
+            else if (strncasecmp(line, "Transfer-Encoding:", 18) == 0) {
+                std::string_view value(line + 18, eol - pos - 18);
+                chunked = value.find("chunked") != std::string_view::npos;
+            }
+            else if (strncasecmp(line, "Connection:", 11) == 0) {
+                const char* value = line + 11;
+                while (*value == ' ') ++value;
+                if (strncasecmp(value, "close", 5) == 0) {
+                    server_closes = true;
+                }
+            }
+            pos = eol + 2;
+        }
+
+        // Keep only the body bytes that arrived with the headers
+        body.Consume(header_end + 4);
+
+        // Framing per RFC 9112 6.3: no body, chunked, Content-Length, or until close
+        if (status / 100 == 1 || status == 204 || status == 304) {
+            content_length = 0;
+            chunked = false;
+            body.Clear();
+        }
+        else if (chunked) {
+            content_length = std::string::npos;
+            raw.assign(body.View());
+            body.Clear();
+            Decode();
+        }
+        else if (content_length == std::string::npos) {
+            server_closes = true;
+        }
+        else if (content_length > MAX_BODY) {
+            failed = true;
+        }
+        else {
+            body.PrepareWrite(content_length - std::min(content_length, body.Size()));
+        }
+        return true;
+    }
+
+    std::string_view Next() override {
+        for (;;) {
+            // Body bytes that arrived together with the headers or were just decoded
+            if (delivered < body.Size()) {
+                std::string_view chunk = body.View().substr(delivered);
+                delivered = body.Size();
+                return chunk;
+            }
+            if (Complete() || failed) return {};
+
+            size_t want = content_length == std::string::npos ? READ_CHUNK : content_length - body.Size();
+            char* target = chunked ? raw_chunk : body.PrepareWrite(want);
+            ssize_t n = recv(fd, target, chunked ? sizeof(raw_chunk) : want, 0);
+            if (n <= 0) {
+                // EOF is only a valid terminator for close-delimited bodies; a
+                // timeout or reset fails the response
+                if (n == 0 && content_length == std::string::npos && !chunked) {
+                    eof = true;
+                }
+                else {
+                    failed = true;
+                }
+                return {};
+            }
+
+            if (chunked) {
+                raw.append(raw_chunk, static_cast<size_t>(n));
+                Decode();
+            }
+            else {
+                body.CommitWrite(static_cast<size_t>(n));
+                if (body.Size() > MAX_BODY) {
+                    failed = true;
+                    return {};
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Read whatever the consumer left unread
+     */
+    void Drain() {
+        while (!Complete() && !failed) {
+            Next();
+        }
+    }
+
+    bool Complete() const {
+        if (failed) return false;
+        if (chunked) return chunk_state == ChunkState::Done;
+        return content_length == std::string::npos ? eof : body.Size() >= content_length;
+    }
+
+    int Status() const override { return status; }
+
+    std::string_view Header(std::string_view name) const override {
+        return FindHttpHeader(head, name);
+    }
+
+    bool ServerCloses() const { return server_closes; }
+
+private:
+    static constexpr size_t READ_CHUNK = 16384;
+    static constexpr size_t MAX_CHUNK_LINE = 4096;  // Size line with extensions, or a trailer
+
+    enum class ChunkState { Size, Data, DataEnd, Trailer, Done };
+
+    /**
+     * @brief Move the data bytes of the complete parts of 'raw' into the body
+     */
+    void Decode() {
+        size_t pos = 0;
+        while (!failed && chunk_state != ChunkState::Done) {
+            if (chunk_state == ChunkState::Size || chunk_state == ChunkState::Trailer) {
+                size_t eol = raw.find("\r\n", pos);
+                if (eol == std::string::npos) {
+                    failed = raw.size() - pos > MAX_CHUNK_LINE;
+                    break;
+                }
+                if (chunk_state == ChunkState::Size) {
+                    // Hex size, optionally followed by ";extension"
+                    const char* line = raw.c_str() + pos;
+                    char* end = nullptr;
+                    unsigned long long size = std::strtoull(line, &end, 16);
+                    if (end == line || size > MAX_BODY - body.Size()) {
+                        failed = true;
+                        break;
+                    }
+                    chunk_left = static_cast<size_t>(size);
+                    chunk_state = chunk_left == 0 ? ChunkState::Trailer : ChunkState::Data;
+                }
+                else if (eol == pos) {
+                    chunk_state = ChunkState::Done;     // Empty line ends the trailers
+                }
+                pos = eol + 2;
+            }
+            else if (chunk_state == ChunkState::Data) {
+                size_t n = std::min(chunk_left, raw.size() - pos);
+                if (n == 0) break;
+                std::memcpy(body.PrepareWrite(n), raw.data() + pos, n);
+                body.CommitWrite(n);
+                chunk_left -= n;
+                pos += n;
+                if (chunk_left == 0) chunk_state = ChunkState::DataEnd;
+            }
+            else {
+                if (raw.size() - pos < 2) break;
+                if (raw.compare(pos, 2, "\r\n") != 0) {
+                    failed = true;
+                    break;
+                }
+                pos += 2;
+                chunk_state = ChunkState::Size;
+            }
+        }
+        raw.erase(0, pos);
+    }
+
+    int fd;
+    ResponseBuffer& body;
+    std::string head;               // Status line and headers
+    int status = 0;
+    size_t content_length = std::string::npos;
+    size_t delivered = 0;           // Bytes already handed out by Next()
+    bool chunked = false;
+    std::string raw;                // Chunked framing received but not yet decoded
+    char raw_chunk[READ_CHUNK];     // recv() target for chunked bodies
+    ChunkState chunk_state = ChunkState::Size;
+    size_t chunk_left = 0;          // Data bytes left in the current chunk
+    bool server_closes = false;
+    bool eof = false;
+    bool failed = false;
+};
+
+/**
+ * @brief RFC 6455 client over a connected socket
+ *
+ * Frames are parsed in place from the receive buffer; a read offset is
+ * kept so a recv() holding many small frames costs one compaction, not
+ * one memmove per frame. Outgoing frames are masked as clients must.
+ */
+class PosixWebSocket : public WebSocket {
+public:
+    PosixWebSocket(int fd, ResponseBuffer received, std::function<void()> on_close)
+        : fd(fd), rx(std::move(received)), on_close(std::move(on_close)), rng(std::random_device()()) {
+    }
+
+    ~PosixWebSocket() override {
+        if (!closed) {
+            static const unsigned char normal_closure[2] = { 0x03, 0xE8 };  // 1000
+            SendFrame(OP_CLOSE, std::string_view(reinterpret_cast<const char*>(normal_closure), 2));
+        }
+        on_close();
+        close(fd);
+    }
+
+    bool SendText(std::string_view text) override {
+        return !closed && SendFrame(OP_TEXT, text);
+    }
+
+    Status Receive(ResponseBuffer& message, std::chrono::milliseconds timeout) override {
+        message.Clear();
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        while (!closed) {
+            // Whole frames already buffered
+            std::string_view frame_payload;
+            uint8_t opcode = 0;
+            bool fin = false;
+            while (NextFrame(opcode, fin, frame_payload)) {
+                switch (opcode) {
+                case OP_CONTINUATION:
+                case OP_TEXT:
+                case OP_BINARY:
+                    if (fin && opcode != OP_CONTINUATION) {
+                        std::memcpy(message.PrepareWrite(frame_payload.size()), frame_payload.data(), frame_payload.size());
+                        message.CommitWrite(frame_payload.size());
+                        return Status::Message;
+                    }
+                    std::memcpy(fragments.PrepareWrite(frame_payload.size()), frame_payload.data(), frame_payload.size());
+                    fragments.CommitWrite(frame_payload.size());
+                    if (fin) {
+                        std::memcpy(message.PrepareWrite(fragments.Size()), fragments.View().data(), fragments.Size());
+                        message.CommitWrite(fragments.Size());
+                        fragments.Clear();
+                        return Status::Message;
+                    }
+                    break;
+                case OP_PING:
+                    if (!SendFrame(OP_PONG, frame_payload)) closed = true;
+                    break;
+                case OP_CLOSE:
+                    SendFrame(OP_CLOSE, frame_payload.substr(0, std::min<size_t>(frame_payload.size(), 2)));
+                    closed = true;
+                    return Status::Closed;
+                default:
+                    break;  // Pong or reserved opcode
+                }
+            }
+            if (closed) break;
+
+            // Wait for more bytes; a timeout leaves any partial frame buffered
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now());
+            pollfd waiter{ fd, POLLIN, 0 };
+            int ready = poll(&waiter, 1, static_cast<int>(std::max<long long>(remaining.count(), 0)));
+            if (ready == 0) return Status::Timeout;
+            if (ready < 0) {
+                closed = true;
+                break;
+            }
+
+            rx.Consume(rx_pos);
+            rx_pos = 0;
+            ssize_t n = recv(fd, rx.PrepareWrite(READ_CHUNK), READ_CHUNK, 0);
+            if (n <= 0) {
+                closed = true;
+                break;
+            }
+            rx.CommitWrite(static_cast<size_t>(n));
+        }
+        return Status::Closed;
+    }
+
+private:
+    static constexpr size_t READ_CHUNK = 16384;
+    static constexpr uint64_t MAX_FRAME = 64 * 1024 * 1024;    // Larger frames fail the connection
+    static constexpr uint8_t OP_CONTINUATION = 0x0;
+    static constexpr uint8_t OP_TEXT = 0x1;
+    static constexpr uint8_t OP_BINARY = 0x2;
+    static constexpr uint8_t OP_CLOSE = 0x8;
+    static constexpr uint8_t OP_PING = 0x9;
+    static constexpr uint8_t OP_PONG = 0xA;
+
+    /**
+     * @brief Take the next complete frame from the receive buffer
+     * @param payload View into the receive buffer, valid until the next recv
+     * @return false if no complete frame is buffered
+     */
+    bool NextFrame(uint8_t& opcode, bool& fin, std::string_view& payload) {
+        std::string_view buffered = rx.View().substr(rx_pos);
+        if (buffered.size() < 2) return false;
+
+        const unsigned char* head = reinterpret_cast<const unsigned char*>(buffered.data());
+        fin = (head[0] & 0x80) != 0;
+        opcode = head[0] & 0x0F;
+        if (head[1] & 0x80) {
+            closed = true;      // Servers must not mask (RFC 6455 5.1)
+            return false;
+        }
+        uint64_t length = head[1] & 0x7F;
+        size_t header = 2;
+        if (length == 126) {
+            if (buffered.size() < 4) return false;
+            length = (static_cast<uint64_t>(head[2]) << 8) | head[3];
+            header = 4;
+        }
+        else if (length == 127) {
+            if (buffered.size() < 10) return false;
+            length = 0;
+            for (int i = 0; i < 8; ++i) length = (length << 8) | head[2 + i];
+            header = 10;
+        }
+        if (length > MAX_FRAME) {
+            closed = true;
+            return false;
+        }
+        if (buffered.size() < header + length) return false;
+
+        payload = buffered.substr(header, static_cast<size_t>(length));
+        rx_pos += header + static_cast<size_t>(length);
+        return true;
+    }
+
+    bool SendFrame(uint8_t opcode, std::string_view payload) {
+        unsigned char mask[4];
+        uint32_t key = rng();
+        std::memcpy(mask, &key, sizeof(mask));
+
+        tx.clear();
+        tx += static_cast<char>(0x80 | opcode);
+        if (payload.size() < 126) {
+            tx += static_cast<char>(0x80 | payload.size());
+        }
+        else if (payload.size() <= 0xFFFF) {
+            tx += static_cast<char>(0x80 | 126);
+            tx += static_cast<char>(payload.size() >> 8);
+            tx += static_cast<char>(payload.size() & 0xFF);
+        }
+        else {
+            tx += static_cast<char>(0x80 | 127);
+            for (int shift = 56; shift >= 0; shift -= 8) {
+                tx += static_cast<char>((static_cast<uint64_t>(payload.size()) >> shift) & 0xFF);
+            }
+        }
+        tx.append(reinterpret_cast<const char*>(mask), sizeof(mask));
+        for (size_t i = 0; i < payload.size(); ++i) {
+            tx += static_cast<char>(payload[i] ^ static_cast<char>(mask[i & 3]));
+        }
+        return SendAll(fd, tx);
+    }
+
+    int fd;
+    ResponseBuffer rx;                  // Raw bytes received; frames start at rx_pos
+    size_t rx_pos = 0;                  // First byte not yet parsed
+    ResponseBuffer fragments{ 0 };      // Payload of a fragmented message so far
+    std::string tx;                     // Outgoing frame, reused
+    std::function<void()> on_close;     // Unregisters the socket from the transport
+    std::mt19937 rng;                   // Masking keys
+    bool closed = false;
+};
+
+} // namespace
+
+PosixHttpTransport::PosixHttpTransport(std::chrono::milliseconds timeout)
+    : timeout(timeout) {
+}
+
+PosixHttpTransport::~PosixHttpTransport() {
+    for (auto& entry : idle_connections) {
+        for (int fd : entry.second) {
+            close(fd);
+        }
+    }
+}
+
+int PosixHttpTransport::AcquireConnection(const HttpEndpoint& endpoint, const std::string& key, bool& reused) {
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        auto it = idle_connections.find(key);
+        if (it != idle_connections.end() && !it->second.empty()) {
+            int fd = it->second.back();
+            it->second.pop_back();
+            reused = true;
+            return fd;
+        }
+    }
+
+    reused = false;
+    return ConnectTo(endpoint, timeout);
+}
+
+void PosixHttpTransport::ReleaseConnection(const std::string& key, int fd) {
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    auto& idle = idle_connections[key];
+    if (idle.size() < MAX_IDLE_PER_HOST) {
+        idle.push_back(fd);
+    }
+    else {
+        close(fd);
+    }
+}
+
+bool PosixHttpTransport::TrackActive(int fd, uint64_t generation) {
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    if (generation != cancel_generation) return false;
+    active_connections.push_back(fd);
+    return true;
+}
+
+void PosixHttpTransport::UntrackActive(int fd) {
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    auto it = std::find(active_connections.begin(), active_connections.end(), fd);
+    if (it != active_connections.end()) {
+        *it = active_connections.back();
+        active_connections.pop_back();
+    }
+}
+
+void PosixHttpTransport::CancelAll() {
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    ++cancel_generation;
+
+    // Wakes any send()/recv() blocked on these sockets; their owners close them
+    for (int fd : active_connections) {
+        shutdown(fd, SHUT_RDWR);
+    }
+}
+
+bool PosixHttpTransport::GetStreaming(const HttpEndpoint& endpoint, const std::string& path,
+    ResponseBuffer& body, const BodyConsumer& consume) {
+    if (endpoint.secure) return false;      // No TLS in this transport
+    requests.fetch_add(1);
+
+    uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        generation = cancel_generation;
+    }
+
+    std::string key = endpoint.host + ":" + std::to_string(endpoint.port);
+    std::string request = "GET " + path + " HTTP/1.1\r\n"
+        "Host: " + endpoint.host + "\r\n"
+        "User-Agent: CryptoTracker/1.0\r\n"
+        "Accept: application/json\r\n"
+        "Connection: keep-alive\r\n\r\n";
+
+    // A pooled connection may have been closed by the server while idle;
+    // in that case retry once on a fresh connection.
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        bool reused = false;
+        int fd = AcquireConnection(endpoint, key, reused);
+        if (fd < 0) return false;
+        if (!TrackActive(fd, generation)) {
+            close(fd);
+            return false;
+        }
+
+        SocketBodyStream stream(fd, body);
+        if (!SendAll(fd, request) || !stream.ReadHeaders()) {
+            UntrackActive(fd);
+            close(fd);
+            if (reused) continue;
+            return false;
+        }
+
+        (reused ? connections_reused : connections_opened).fetch_add(1);
+
+        consume(stream);
+        stream.Drain();
+
+        UntrackActive(fd);
+        bool complete = stream.Complete();
+        if (complete && !stream.ServerCloses()) {
+            ReleaseConnection(key, fd);
+        }
+        else {
+            close(fd);
+        }
+        return complete;
+    }
+
+    return false;
+}
+
+std::unique_ptr<WebSocket> PosixHttpTransport::OpenWebSocket(const HttpEndpoint& endpoint, const std::string& path) {
+    if (endpoint.secure) return nullptr;    // No TLS in this transport
+    requests.fetch_add(1);
+
+    uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        generation = cancel_generation;
+    }
+
+    int fd = ConnectTo(endpoint, timeout);
+    if (fd < 0) return nullptr;
+    connections_opened.fetch_add(1);
+    if (!TrackActive(fd, generation)) {
+        close(fd);
+        return nullptr;
+    }
+
+    unsigned char nonce[16];
+    std::random_device random;
+    for (unsigned char& byte : nonce) byte = static_cast<unsigned char>(random());
+    std::string key = Base64(nonce, sizeof(nonce));
+    std::string request = "GET " + path + " HTTP/1.1\r\n"
+        "Host: " + endpoint.host + ":" + std::to_string(endpoint.port) + "\r\n"
+        "User-Agent: CryptoTracker/1.0\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        "Sec-WebSocket-Key: " + key + "\r\n"
+        "Sec-WebSocket-Version: 13\r\n\r\n";
+
+    // Frames may follow the headers in the same read
+    ResponseBuffer received(16384);
+    size_t header_end = std::string_view::npos;
+    bool ok = SendAll(fd, request);
+    while (ok && header_end == std::string_view::npos) {
+        ssize_t n = recv(fd, received.PrepareWrite(4096), 4096, 0);
+        ok = n > 0;
+        if (ok) {
+            received.CommitWrite(static_cast<size_t>(n));
+            header_end = received.View().find("\r\n\r\n");
+            ok = header_end != std::string_view::npos || received.Size() <= MAX_HEADERS;
+        }
+    }
+
+    // The server must switch protocols and prove it read this handshake's key
+    std::string_view head = ok ? received.View().substr(0, header_end + 2) : std::string_view();
+    ok = ok && head.size() >= 13 && head.substr(9, 4) == "101 " &&
+        FindHttpHeader(head, "Sec-WebSocket-Accept") == WebSocketAccept(key);
+    if (!ok) {
+        UntrackActive(fd);
+        close(fd);
+        return nullptr;
+    }
+    received.Consume(header_end + 4);
+
+    return std::make_unique<PosixWebSocket>(fd, std::move(received), [this, fd] { UntrackActive(fd); });
+}
+
+TransportStats PosixHttpTransport::GetStats() const {
+    TransportStats stats;
+    stats.requests = requests.load();
+    stats.connections_opened = connections_opened.load();
+    stats.connections_reused = connections_reused.load();
+    return stats;
+}
+
+#endif // !_WIN32
@@ -0,0 +1,70 @@
+#pragma once
+#include "HttpTransport.h"
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+
+/**
+ * @brief HttpTransport implementation over BSD sockets (Linux/macOS)
+ *
+ * Speaks plain HTTP/1.1 only; intended for local stand-in servers and
+ * benchmarks. Connections are kept alive and pooled per host:port; a
+ * response is reusable when it carries Content-Length or is chunked and
+ * the server did not ask to close. Connecting and every send()/recv() give
+ * up after the I/O timeout, and bodies over 256 MB fail the request. Thread-safe: concurrent requests each take their own
+ * connection from the pool. WebSockets get a dedicated connection that is
+ * never pooled. Sockets in use are tracked so CancelAll() can shut them
+ * down under a blocked recv().
+ */
+class PosixHttpTransport : public HttpTransport {
+public:
+    /**
+     * @param timeout Longest wait to connect and for each send()/recv() (0 = no limit)
+     */
+    explicit PosixHttpTransport(std::chrono::milliseconds timeout = std::chrono::seconds(30));
+    ~PosixHttpTransport() override;
+
+    bool GetStreaming(const HttpEndpoint& endpoint, const std::string& path,
+        ResponseBuffer& body, const BodyConsumer& consume) override;
+    std::unique_ptr<WebSocket> OpenWebSocket(const HttpEndpoint& endpoint, const std::string& path) override;
+    void CancelAll() override;
+    TransportStats GetStats() const override;
+
+private:
+    /**
+     * @brief Take an idle pooled connection or open a new one
+     * @param reused Set to true if the connection came from the pool
+     * @return Socket descriptor, or -1 on failure
+     */
+    int AcquireConnection(const HttpEndpoint& endpoint, const std::string& key, bool& reused);
+
+    /**
+     * @brief Return a healthy connection to the idle pool
+     */
+    void ReleaseConnection(const std::string& key, int fd);
+
+    /**
+     * @brief Register a socket as in use by a request
+     * @param generation cancel_generation when the request started
+     * @return false if CancelAll() ran since then (the request must abort)
+     */
+    bool TrackActive(int fd, uint64_t generation);
+
+    /**
+     * @brief Unregister a socket before it is pooled or closed
+     */
+    void UntrackActive(int fd);
+
+    static constexpr size_t MAX_IDLE_PER_HOST = 16;     // Idle sockets kept per host (>= fetch concurrency)
+
+    std::chrono::milliseconds timeout;                              // Connect and per-send()/recv() limit
+    std::mutex pool_mutex;                                          // Protects the members below
+    std::unordered_map<std::string, std::vector<int>> idle_connections; // "host:port" -> idle sockets
+    std::vector<int> active_connections;                            // Sockets with a request in flight
+    uint64_t cancel_generation = 0;                                 // Bumped by every CancelAll()
+    std::atomic<uint64_t> requests{ 0 };
+    std::atomic<uint64_t> connections_opened{ 0 };
+    std::atomic<uint64_t> connections_reused{ 0 };
+};
@@ -0,0 +1,104 @@
+#include "PriceFormat.h"
+#include "CoinCatalog.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+constexpr int SIGNIFICANT_DIGITS = 4;   // For prices below 1
+constexpr int MAX_DECIMALS = 12;
+
+// Copy a fixed-point number, inserting ',' every three integer digits
+size_t GroupThousands(const char* digits, size_t length, char* out) {
+    size_t integer_end = 0;
+    while (integer_end < length && digits[integer_end] != '.') ++integer_end;
+
+    size_t n = 0;
+    for (size_t i = 0; i < integer_end; ++i) {
+        if (i > 0 && (integer_end - i) % 3 == 0) out[n++] = ',';
+        out[n++] = digits[i];
+    }
+    std::memcpy(out + n, digits + integer_end, length - integer_end);
+    return n + (length - integer_end);
+}
+
+} // namespace
+
+namespace PriceFormat {
+
+size_t FormatPrice(double price, char* buffer, size_t size) {
+    if (size < PRICE_CHARS) return 0;
+
+    char digits[PRICE_CHARS];
+    double magnitude = std::fabs(price);
+
+    int decimals = 2;
+    if (magnitude > 0.0 && magnitude < 1.0) {
+        int exponent = static_cast<int>(std::floor(std::log10(magnitude)));
+        decimals = std::min(MAX_DECIMALS, SIGNIFICANT_DIGITS - 1 - exponent);
+    }
+
+    // Anything that does not fit is shown without grouping
+    auto result = std::to_chars(digits, digits + sizeof(digits), magnitude, std::chars_format::fixed, decimals);
+    if (result.ec != std::errc() || magnitude >= 1e24) {
+        result = std::to_chars(buffer + 1, buffer + size - 1, price, std::chars_format::general);
+        buffer[0] = '$';
+        *result.ptr = '\0';
+        return static_cast<size_t>(result.ptr - buffer);
+    }
+
+    size_t n = 0;
+    if (price < 0.0) buffer[n++] = '-';
+    buffer[n++] = '$';
+    n += GroupThousands(digits, static_cast<size_t>(result.ptr - digits), buffer + n);
+    buffer[n] = '\0';
+    return n;
+}
+
+size_t FormatChange(double change, char* buffer, size_t size) {
+    if (size < CHANGE_CHARS) return 0;
+
+    // Values that round to zero print as "+0.00%" rather than "-0.00%"
+    if (std::fabs(change) < 0.005) change = 0.0;
+
+    size_t n = 0;
+    if (change >= 0.0) buffer[n++] = '+';
+    auto result = std::to_chars(buffer + n, buffer + size - 2, change, std::chars_format::fixed, 2);
+    if (result.ec != std::errc()) {
+        result = std::to_chars(buffer + n, buffer + size - 2, change, std::chars_format::general);
+    }
+    n = static_cast<size_t>(result.ptr - buffer);
+    buffer[n++] = '%';
+    buffer[n] = '\0';
+    return n;
+}
+
+} // namespace PriceFormat
+
+void QuoteTextCache::Bind(const std::shared_ptr<const CoinCatalog>& catalog) {
+    if (this->catalog == catalog) return;
+
+    this->catalog = catalog;
+    QuoteText empty;
+    empty.price = std::numeric_limits<double>::quiet_NaN();     // NaN never compares equal: formats on first use
+    empty.change_24h = empty.price;
+    empty.price_text[0] = '\0';
+    empty.change_text[0] = '\0';
+    entries.assign(catalog ? catalog->Size() : 0, empty);
+}
+
+const QuoteText& QuoteTextCache::Get(size_t index, double price, double change_24h) {
+    QuoteText& entry = entries[index];
+    if (entry.price != price) {
+        entry.price = price;
+        PriceFormat::FormatPrice(price, entry.price_text, sizeof(entry.price_text));
+    }
+    if (entry.change_24h != change_24h) {
+        entry.change_24h = change_24h;
+        PriceFormat::FormatChange(change_24h, entry.change_text, sizeof(entry.change_text));
+    }
+    return entry;
+}
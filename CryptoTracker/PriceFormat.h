@@ -0,0 +1,66 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class CoinCatalog;
+
+/**
+ * @brief Allocation-free price / percentage formatting
+ *
+ * Both functions write a null-terminated string into the caller's buffer
+ * with std::to_chars and return its length (0 if the buffer is too small).
+ */
+namespace PriceFormat {
+
+constexpr size_t PRICE_CHARS = 40;      // Enough for any grouped price
+constexpr size_t CHANGE_CHARS = 24;     // Enough for any percentage
+
+/**
+ * @brief Format a USD price, e.g. "$43,250.12", "$0.9998", "$0.00001234"
+ *
+ * Prices of 1 and above get two decimals and thousands separators; smaller
+ * prices keep four significant digits so sub-cent coins do not read $0.00.
+ */
+size_t FormatPrice(double price, char* buffer, size_t size);
+
+/**
+ * @brief Format a percentage change with sign, e.g. "+2.35%", "-0.41%"
+ */
+size_t FormatChange(double change, char* buffer, size_t size);
+
+} // namespace PriceFormat
+
+/**
+ * @brief Formatted price/change text for one coin
+ */
+struct QuoteText {
+    double price;                                   // Values the text was formatted from
+    double change_24h;
+    char price_text[PriceFormat::PRICE_CHARS];
+    char change_text[PriceFormat::CHANGE_CHARS];
+};
+
+/**
+ * @brief Per-coin cache of formatted quote text
+ *
+ * Sized to the coin catalog; an entry is re-formatted only when its coin's
+ * price or change differs from the values it was built from, so frames
+ * that draw unchanged coins do no formatting and no allocation.
+ */
+class QuoteTextCache {
+public:
+    /**
+     * @brief Drop all entries if the catalog changed
+     */
+    void Bind(const std::shared_ptr<const CoinCatalog>& catalog);
+
+    /**
+     * @brief Text for a coin, re-formatted if the values changed
+     */
+    const QuoteText& Get(size_t index, double price, double change_24h);
+
+private:
+    std::shared_ptr<const CoinCatalog> catalog;     // Catalog the entries belong to
+    std::vector<QuoteText> entries;                 // One per coin
+};
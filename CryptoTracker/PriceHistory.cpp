@@ -0,0 +1,109 @@
+#include "PriceHistory.h"
+#include <algorithm>
+
+size_t PriceHistory::CapacityForBudget(size_t coin_count, size_t budget_bytes) {
+    if (coin_count == 0) {
+        return 0;
+    }
+    size_t per_coin = budget_bytes / coin_count;
+    if (per_coin < sizeof(Cursor)) {
+        return 0;
+    }
+    size_t capacity = (per_coin - sizeof(Cursor)) / (sizeof(int64_t) + sizeof(double));
+    return capacity - capacity % SAMPLES_PER_LINE;
+}
+
+PriceHistory::PriceHistory(std::shared_ptr<const CoinCatalog> catalog, size_t max_capacity, size_t budget_bytes)
+    : catalog(std::move(catalog)) {
+    coin_count = this->catalog->Size();
+    capacity = std::min(CapacityForBudget(coin_count, budget_bytes),
+        max_capacity - max_capacity % SAMPLES_PER_LINE);
+    line_count = coin_count * capacity / SAMPLES_PER_LINE;
+
+    // Value-initialized: every slot and counter starts at zero
+    times = std::make_unique<Line<int64_t>[]>(line_count);
+    prices = std::make_unique<Line<double>[]>(line_count);
+    cursors = std::make_unique<Cursor[]>(coin_count);
+}
+
+void PriceHistory::Append(size_t index, int64_t timestamp_ms, double price) {
+    if (capacity == 0) {
+        return;
+    }
+    Cursor& cursor = cursors[index];
+    uint64_t seq = cursor.end.load(std::memory_order_relaxed);
+
+    // Announce the overwrite before touching the slot
+    cursor.begin.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    TimeSlot(index, seq).store(timestamp_ms, std::memory_order_relaxed);
+    PriceSlot(index, seq).store(price, std::memory_order_relaxed);
+
+    cursor.end.store(seq + 1, std::memory_order_release);
+}
+
+size_t PriceHistory::ReadWindow(size_t index, int64_t from_ms, int64_t to_ms, std::vector<PriceSample>& out) const {
+    out.clear();
+    if (capacity == 0) {
+        return 0;
+    }
+    const Cursor& cursor = cursors[index];
+
+    for (;;) {
+        uint64_t end = cursor.end.load(std::memory_order_acquire);
+        uint64_t first = end > capacity ? end - capacity : 0;
+
+        // Samples are in time order: skip to 'from_ms', stop after 'to_ms'
+        for (uint64_t seq = first; seq < end; ++seq) {
+            int64_t timestamp = TimeSlot(index, seq).load(std::memory_order_relaxed);
+            if (timestamp < from_ms) continue;
+            if (timestamp > to_ms) break;
+            out.push_back({ timestamp, PriceSlot(index, seq).load(std::memory_order_relaxed) });
+        }
+
+        // Anything at or above 'begin - capacity' was not overwritten while we copied
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t begin = cursor.begin.load(std::memory_order_relaxed);
+        if (begin <= first + capacity) {
+            return out.size();
+        }
+        out.clear();
+    }
+}
+
+size_t PriceHistory::ReadWindow(std::string_view coin_id, int64_t from_ms, int64_t to_ms,
+    std::vector<PriceSample>& out) const {
+    size_t index = catalog->Index().FindById(coin_id);
+    if (index == CoinIndex::NOT_FOUND) {
+        out.clear();
+        return 0;
+    }
+    return ReadWindow(index, from_ms, to_ms, out);
+}
+
+void PriceHistory::CopyFrom(const PriceHistory& previous) {
+    if (capacity == 0 || previous.capacity == 0) {
+        return;
+    }
+    for (size_t index = 0; index < coin_count; ++index) {
+        size_t old_index = previous.catalog->Index().FindById(catalog->Id(index));
+        if (old_index == CoinIndex::NOT_FOUND) continue;
+
+        uint64_t old_end = previous.cursors[old_index].end.load(std::memory_order_acquire);
+        uint64_t count = std::min<uint64_t>({ old_end, previous.capacity, capacity });
+        for (uint64_t i = 0; i < count; ++i) {
+            uint64_t old_seq = old_end - count + i;
+            TimeSlot(index, i).store(previous.TimeSlot(old_index, old_seq).load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            PriceSlot(index, i).store(previous.PriceSlot(old_index, old_seq).load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+        }
+        cursors[index].begin.store(count, std::memory_order_relaxed);
+        cursors[index].end.store(count, std::memory_order_release);
+    }
+}
+
+size_t PriceHistory::MemoryBytes() const {
+    return 2 * line_count * sizeof(Line<double>) + coin_count * sizeof(Cursor);
+}
@@ -0,0 +1,137 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+#include "CoinCatalog.h"
+
+/**
+ * @brief One recorded price tick
+ */
+struct PriceSample {
+    int64_t timestamp_ms = 0;   // Time the price was applied (ms since epoch)
+    double price = 0.0;         // USD price
+};
+
+/**
+ * @brief Fixed-capacity price history for every coin of a catalog
+ *
+ * Each coin owns a ring buffer of 'Capacity()' samples. All rings live in
+ * one arena split into two columns (timestamps, prices); each coin's slice
+ * of a column starts on a cache line and the capacity is derived from a
+ * byte budget, so memory is bounded and allocated once per catalog.
+ *
+ * There is a single writer (the fetch path, serialized by fetch_mutex).
+ * Readers never lock: every coin carries two counters that the writer
+ * bumps before and after overwriting a slot (a per-coin seqlock), and a
+ * reader drops whatever samples may have been overwritten while it copied.
+ */
+class PriceHistory {
+public:
+    static constexpr size_t CACHE_LINE = 64;
+    static constexpr size_t SAMPLES_PER_LINE = CACHE_LINE / sizeof(double);
+
+    /**
+     * @brief Bytes needed per coin for a given ring capacity (columns + counters)
+     */
+    static constexpr size_t BytesPerCoin(size_t capacity) {
+        return capacity * (sizeof(int64_t) + sizeof(double)) + sizeof(Cursor);
+    }
+
+    /**
+     * @brief Largest cache-line multiple capacity that keeps 'coin_count' rings within 'budget_bytes'
+     */
+    static size_t CapacityForBudget(size_t coin_count, size_t budget_bytes);
+
+    /**
+     * @brief Allocate empty rings for every coin of a catalog
+     * @param catalog Coins the history is indexed by
+     * @param max_capacity Samples wanted per coin
+     * @param budget_bytes Upper bound on the arena and counters; lowers the capacity for large catalogs
+     */
+    PriceHistory(std::shared_ptr<const CoinCatalog> catalog, size_t max_capacity, size_t budget_bytes);
+
+    PriceHistory(const PriceHistory&) = delete;
+    PriceHistory& operator=(const PriceHistory&) = delete;
+
+    size_t Size() const { return coin_count; }
+    size_t Capacity() const { return capacity; }
+    const CoinCatalog& Catalog() const { return *catalog; }
+
+    /**
+     * @brief Record a tick (single writer)
+     *
+     * Samples are expected in time order per coin; when the ring is full
+     * the oldest one is overwritten.
+     */
+    void Append(size_t index, int64_t timestamp_ms, double price);
+
+    /**
+     * @brief Copy a coin's samples with from_ms <= timestamp <= to_ms (lock-free)
+     * @param out Cleared, then filled oldest first
+     * @return Number of samples written to 'out'
+     */
+    size_t ReadWindow(size_t index, int64_t from_ms, int64_t to_ms, std::vector<PriceSample>& out) const;
+
+    /**
+     * @brief ReadWindow by CoinGecko ID
+     * @return 0 (and an empty 'out') if the ID is unknown
+     */
+    size_t ReadWindow(std::string_view coin_id, int64_t from_ms, int64_t to_ms, std::vector<PriceSample>& out) const;
+
+    /**
+     * @brief Samples ever appended for a coin (including overwritten ones)
+     */
+    uint64_t Appended(size_t index) const { return cursors[index].end.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Carry over the samples of coins that are also in 'previous' (matched by ID)
+     *
+     * Call before the history is shared with readers.
+     */
+    void CopyFrom(const PriceHistory& previous);
+
+    /**
+     * @brief Heap bytes used by the arena and counters
+     */
+    size_t MemoryBytes() const;
+
+private:
+    /**
+     * @brief Seqlock counters of one ring
+     *
+     * 'begin' is bumped before a slot is overwritten and 'end' after, so
+     * sequence numbers below 'begin - capacity' may be torn.
+     */
+    struct Cursor {
+        std::atomic<uint64_t> begin{ 0 };
+        std::atomic<uint64_t> end{ 0 };
+    };
+
+    /**
+     * @brief One cache line worth of a column
+     */
+    template <typename T>
+    struct alignas(CACHE_LINE) Line {
+        std::atomic<T> values[SAMPLES_PER_LINE];
+    };
+
+    std::atomic<int64_t>& TimeSlot(size_t index, uint64_t seq) const {
+        size_t slot = index * capacity + static_cast<size_t>(seq % capacity);
+        return times[slot / SAMPLES_PER_LINE].values[slot % SAMPLES_PER_LINE];
+    }
+
+    std::atomic<double>& PriceSlot(size_t index, uint64_t seq) const {
+        size_t slot = index * capacity + static_cast<size_t>(seq % capacity);
+        return prices[slot / SAMPLES_PER_LINE].values[slot % SAMPLES_PER_LINE];
+    }
+
+    std::shared_ptr<const CoinCatalog> catalog; // ID -> index mapping of the rings
+    size_t capacity = 0;                        // Samples per coin (multiple of SAMPLES_PER_LINE)
+    std::unique_ptr<Line<int64_t>[]> times;     // Timestamp column, 'capacity' per coin
+    std::unique_ptr<Line<double>[]> prices;     // Price column, 'capacity' per coin
+    std::unique_ptr<Cursor[]> cursors;          // Per-coin write counters
+    size_t line_count = 0;                      // Lines per column
+    size_t coin_count = 0;
+};
@@ -6,268 +6,1098 @@
 #include <iomanip>
 #include <sstream>
 #include <iostream>
-#include <windows.h>
-#include <winhttp.h>
-
-#pragma comment(lib, "winhttp.lib")
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
 
 using json = nlohmann::json;
 namespace fs = std::filesystem;
 
-// Helper function to make HTTP GET request using WinHTTP
-std::string HttpGet(const std::wstring& server, const std::wstring& path) {
-    std::string response;
+namespace {
+
+double MicrosecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+// How long an idle stream waits in Receive() before re-checking for shutdown
+constexpr std::chrono::milliseconds STREAM_IDLE_WAIT{ 1000 };
+
+// Shortest gap between the starts of two scheduled fetches, so coins falling
+// due one after another are gathered into shared requests
+constexpr std::chrono::milliseconds MIN_FETCH_GAP{ 1000 };
 
-    HINTERNET hSession = WinHttpOpen(L"CryptoTracker/1.0",
-        WINHTTP_ACCESS_TYPE_DEFAULT_PROXY,
-        WINHTTP_NO_PROXY_NAME,
-        WINHTTP_NO_PROXY_BYPASS, 0);
+// Coins due this soon after a fetch starts are fetched with it
+constexpr std::chrono::milliseconds DUE_WINDOW{ 1000 };
 
-    if (!hSession) return "";
+} // namespace
 
-    HINTERNET hConnect = WinHttpConnect(hSession, server.c_str(),
-        INTERNET_DEFAULT_HTTP_PORT, 0);
+PriceManager::PriceManager()
+    : PriceManager(CreateDefaultTransport(), PriceManagerConfig()) {
+}
 
-    if (!hConnect) {
-        WinHttpCloseHandle(hSession);
-        return "";
+PriceManager::PriceManager(std::unique_ptr<HttpTransport> transport, const PriceManagerConfig& config)
+    : config(config), transport(std::move(transport)), should_stop(false), is_connected(false),
+      update_interval(config.update_interval), alerts(config.alerts), data_version(0) {
+    CreateProviders();
+    if (config.persist_ticks) {
+        TickLogOptions options;
+        options.directory = config.tick_log_directory;
+        options.segment_bytes = config.tick_log_segment_bytes;
+        options.max_total_bytes = config.tick_log_max_bytes;
+        tick_log = std::make_unique<TickLog>(options);
+    }
+    InitializeCoins();
+    if (config.persist_watchlist) {
+        LoadWatchlist();
     }
 
-    HINTERNET hRequest = WinHttpOpenRequest(hConnect, L"GET", path.c_str(),
-        NULL, WINHTTP_NO_REFERER,
-        WINHTTP_DEFAULT_ACCEPT_TYPES,
-        0);
+    {
+        std::lock_guard<std::mutex> lock(data_mutex);
+        PublishSnapshot();
+    }
 
-    if (!hRequest) {
-        WinHttpCloseHandle(hConnect);
-        WinHttpCloseHandle(hSession);
-        return "";
+    // Start background thread for periodic updates
+    if (config.start_update_thread) {
+        update_thread = std::thread(&PriceManager::UpdateThreadFunc, this);
+    }
+    if (config.stream_prices) {
+        stream_thread = std::thread(&PriceManager::StreamThreadFunc, this);
     }
+}
 
-    BOOL bResults = WinHttpSendRequest(hRequest,
-        WINHTTP_NO_ADDITIONAL_HEADERS, 0,
-        WINHTTP_NO_REQUEST_DATA, 0,
-        0, 0);
+PriceManager::~PriceManager() {
+    // Signal thread to stop and abort whatever it is downloading
+    {
+        std::lock_guard<std::mutex> lock(schedule_mutex);
+        should_stop.store(true);
+    }
+    schedule_cv.notify_all();
+    {
+        std::lock_guard<std::mutex> lock(notify_mutex);
+    }
+    data_changed_cv.notify_all();   // Wakes the alert thread
+    transport->CancelAll();
+    for (auto& provider : providers) {
+        provider->Cancel();
+    }
 
-    if (bResults) {
-        bResults = WinHttpReceiveResponse(hRequest, NULL);
+    // Wait for threads to finish
+    if (update_thread.joinable()) {
+        update_thread.join();
+    }
+    if (stream_thread.joinable()) {
+        stream_thread.join();
+    }
+    if (alert_thread.joinable()) {
+        alert_thread.join();
     }
 
-    if (bResults) {
-        DWORD dwSize = 0;
-        DWORD dwDownloaded = 0;
+    // Save watchlist before exit
+    if (config.persist_watchlist) {
+        SaveWatchlist();
+    }
+}
 
-        do {
-            dwSize = 0;
-            if (!WinHttpQueryDataAvailable(hRequest, &dwSize)) {
-                break;
-            }
+void PriceManager::InitializeCoins() {
+    // Initialize with 20 popular cryptocurrencies
+    ResetCoinStore(std::make_shared<const CoinCatalog>(std::vector<CoinInfo>{
+        { "bitcoin", "BTC", "Bitcoin" },
+        { "ethereum", "ETH", "Ethereum" },
+        { "tether", "USDT", "Tether" },
+        { "binancecoin", "BNB", "BNB" },
+        { "solana", "SOL", "Solana" },
+        { "ripple", "XRP", "XRP" },
+        { "usd-coin", "USDC", "USD Coin" },
+        { "cardano", "ADA", "Cardano" },
+        { "dogecoin", "DOGE", "Dogecoin" },
+        { "tron", "TRX", "TRON" },
+        { "avalanche-2", "AVAX", "Avalanche" },
+        { "polkadot", "DOT", "Polkadot" },
+        { "chainlink", "LINK", "Chainlink" },
+        { "shiba-inu", "SHIB", "Shiba Inu" },
+        { "bitcoin-cash", "BCH", "Bitcoin Cash" },
+        { "litecoin", "LTC", "Litecoin" },
+        { "polygon", "MATIC", "Polygon" },
+        { "uniswap", "UNI", "Uniswap" },
+        { "stellar", "XLM", "Stellar" },
+        { "monero", "XMR", "Monero" }
+    }));
+    auto rings = std::make_shared<PriceHistory>(store.CatalogPtr(),
+        config.history_capacity, config.history_budget_bytes);
+    if (tick_log) {
+        tick_log->Replay(*rings, HistoryWindowStart(*rings, config.update_interval));
+    }
+    history.store(std::move(rings));
+}
 
-            char* pszOutBuffer = new char[dwSize + 1];
-            ZeroMemory(pszOutBuffer, dwSize + 1);
+void PriceManager::ResetCoinStore(std::shared_ptr<const CoinCatalog> catalog) {
+    store = CoinStore(std::move(catalog));
+    staging.assign(store.Size(), StagedQuote());
+    moved_fields.assign(store.Size(), 0);
+    for (auto& provider : providers) {
+        provider->ResetStaging(store.Size());
+    }
+    tick_keys.clear();
+    if (tick_log) {
+        tick_keys.reserve(store.Size());
+        for (size_t i = 0; i < store.Size(); ++i) {
+            tick_keys.push_back(TickLog::CoinKey(store.Catalog().Id(i)));
+        }
+    }
 
-            if (!WinHttpReadData(hRequest, (LPVOID)pszOutBuffer,
-                dwSize, &dwDownloaded)) {
-                delete[] pszOutBuffer;
-                break;
-            }
+    // Subscribers' slots refer to the old list
+    for (auto& queue : tick_queues) {
+        queue->Close();
+    }
+    tick_queues.clear();
 
-            response.append(pszOutBuffer, dwDownloaded);
-            delete[] pszOutBuffer;
+    // Every coin of the new list is due at once
+    auto now = std::chrono::steady_clock::now();
+    refresh = RefreshScheduler(store.Size(), config.refresh, now);
+    next_refresh_due.store(now);
+}
 
-        } while (dwSize > 0);
+void PriceManager::PublishSnapshot(std::vector<uint32_t> moved) {
+    auto next = std::make_shared<CoinSnapshot>();
+    next->store = store;
+    next->watchlist = store.WatchlistIndices();
+    next->last_update_time = last_update_time;
+
+    // Full copies follow coin-list and watchlist edits
+    std::shared_ptr<const CoinSnapshot> previous = GetSnapshot();
+    next->changes.all = !previous || previous->store.CatalogPtr() != store.CatalogPtr();
+    next->changes.watchlist = next->changes.all || previous->watchlist != next->watchlist;
+    next->changes.slots = std::move(moved);
+    PublishSnapshot(std::move(next));
+}
+
+void PriceManager::PublishSnapshot(std::shared_ptr<CoinSnapshot> next) {
+    uint64_t version = data_version.load(std::memory_order_relaxed) + 1;
+    next->version = version;
+    next->changes.since_version = version - 1;
+    snapshot.store(std::move(next));
+
+    std::function<void(uint64_t)> callback;
+    {
+        std::lock_guard<std::mutex> lock(notify_mutex);
+        data_version.store(version, std::memory_order_release);
+        callback = data_changed_callback;
     }
+    data_changed_cv.notify_all();
 
-    WinHttpCloseHandle(hRequest);
-    WinHttpCloseHandle(hConnect);
-    WinHttpCloseHandle(hSession);
+    if (callback) {
+        callback(version);
+    }
+}
 
-    return response;
+void PriceManager::NotifyStatusChanged() {
+    std::function<void(uint64_t)> callback;
+    {
+        std::lock_guard<std::mutex> lock(notify_mutex);
+        callback = data_changed_callback;
+    }
+    if (callback) {
+        callback(data_version.load(std::memory_order_acquire));
+    }
 }
 
-PriceManager::PriceManager() : should_stop(false), is_connected(false) {
-    InitializeCoins();
-    LoadWatchlist();
+bool PriceManager::WaitForDataChange(uint64_t seen_version, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(notify_mutex);
+    return data_changed_cv.wait_for(lock, timeout, [&] {
+        return data_version.load(std::memory_order_acquire) != seen_version;
+    });
+}
 
-    // Start background thread for periodic updates
-    update_thread = std::thread(&PriceManager::UpdateThreadFunc, this);
+void PriceManager::SetDataChangedCallback(std::function<void(uint64_t)> callback) {
+    std::lock_guard<std::mutex> lock(notify_mutex);
+    data_changed_callback = std::move(callback);
 }
 
-PriceManager::~PriceManager() {
-    // Signal thread to stop
-    should_stop.store(true);
+bool PriceManager::SetWatchlistFlag(std::string_view coinId, bool in_watchlist) {
+    size_t index = store.Catalog().Index().FindById(coinId);
+    if (index == CoinIndex::NOT_FOUND) return false;
+    store.SetWatchlist(index, in_watchlist);
+    return true;
+}
 
-    // Wait for thread to finish
-    if (update_thread.joinable()) {
-        update_thread.join();
+void PriceManager::AddToWatchlist(std::string_view coinId) {
+    std::lock_guard<std::mutex> lock(data_mutex);
+    if (SetWatchlistFlag(coinId, true)) {
+        PublishSnapshot();
     }
+    // Don't save here - will save on app close
+}
 
-    // Save watchlist before exit
-    {
-        //std::lock_guard<std::mutex> lock(data_mutex);
-        SaveWatchlist();
+void PriceManager::RemoveFromWatchlist(std::string_view coinId) {
+    std::lock_guard<std::mutex> lock(data_mutex);
+    if (SetWatchlistFlag(coinId, false)) {
+        PublishSnapshot();
     }
+    // Don't save here - will save on app close
 }
 
-void PriceManager::InitializeCoins() {
-    // Initialize with 20 popular cryptocurrencies
-    coins = {
-        Coin("bitcoin", "BTC", "Bitcoin"),
-        Coin("ethereum", "ETH", "Ethereum"),
-        Coin("tether", "USDT", "Tether"),
-        Coin("binancecoin", "BNB", "BNB"),
-        Coin("solana", "SOL", "Solana"),
-        Coin("ripple", "XRP", "XRP"),
-        Coin("usd-coin", "USDC", "USD Coin"),
-        Coin("cardano", "ADA", "Cardano"),
-        Coin("dogecoin", "DOGE", "Dogecoin"),
-        Coin("tron", "TRX", "TRON"),
-        Coin("avalanche-2", "AVAX", "Avalanche"),
-        Coin("polkadot", "DOT", "Polkadot"),
-        Coin("chainlink", "LINK", "Chainlink"),
-        Coin("shiba-inu", "SHIB", "Shiba Inu"),
-        Coin("bitcoin-cash", "BCH", "Bitcoin Cash"),
-        Coin("litecoin", "LTC", "Litecoin"),
-        Coin("polygon", "MATIC", "Polygon"),
-        Coin("uniswap", "UNI", "Uniswap"),
-        Coin("stellar", "XLM", "Stellar"),
-        Coin("monero", "XMR", "Monero")
-    };
+int64_t PriceManager::HistoryWindowStart(const PriceHistory& rings, std::chrono::milliseconds interval) const {
+    int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    return now_ms - static_cast<int64_t>(rings.Capacity()) * interval.count();
 }
 
-std::vector<Coin>& PriceManager::GetCoins() {
-    return coins;
+size_t PriceManager::ReadTickLog(std::string_view coin_id, int64_t from_ms, int64_t to_ms,
+    std::vector<PriceSample>& out) const {
+    if (!tick_log) {
+        out.clear();
+        return 0;
+    }
+    return tick_log->Read(TickLog::CoinKey(coin_id), from_ms, to_ms, out);
 }
 
-std::vector<Coin> PriceManager::GetWatchlistCoins() {
-    std::lock_guard<std::mutex> lock(data_mutex);
-    std::vector<Coin> watchlist;
+std::shared_ptr<TickQueue> PriceManager::SubscribeTicks(size_t capacity) {
+    std::lock_guard<std::mutex> fetch_lock(fetch_mutex);
+    auto queue = std::make_shared<TickQueue>(store.CatalogPtr(), capacity);
+    tick_queues.push_back(queue);
+    return queue;
+}
+
+void PriceManager::SetTrackedCoins(const std::vector<CoinInfo>& new_coins) {
+    // Interning and indexing can take a while for a large universe; do it before locking
+    auto catalog = std::make_shared<const CoinCatalog>(new_coins);
+    auto next_history = std::make_shared<PriceHistory>(catalog,
+        config.history_capacity, config.history_budget_bytes);
+    int64_t history_start = HistoryWindowStart(*next_history, GetUpdateInterval());
+
+    {
+        // Wait for any in-flight fetch; it parses against the catalog index
+        std::lock_guard<std::mutex> fetch_lock(fetch_mutex);
+
+        // The history writer runs under fetch_mutex, so the old rings are quiescent.
+        // With a tick log, coins new to the list get their logged history too.
+        if (tick_log) {
+            tick_log->Flush();
+            tick_log->Replay(*next_history, history_start);
+        }
+        else {
+            next_history->CopyFrom(*history.load());
+        }
+        history.store(std::move(next_history));
+        std::lock_guard<std::mutex> lock(data_mutex);
+
+        // The old catalog (and the ids it owns) stays alive while we re-flag
+        std::shared_ptr<const CoinCatalog> old_catalog = store.CatalogPtr();
+        std::vector<size_t> watchlist = store.WatchlistIndices();
+
+        ResetCoinStore(std::move(catalog));
 
-    for (const auto& coin : coins) {
-        if (coin.in_watchlist) {
-            watchlist.push_back(coin);
+        for (size_t index : watchlist) {
+            SetWatchlistFlag(old_catalog->Id(index), true);
         }
+        PublishSnapshot();
     }
 
-    return watchlist;
+    // The new coins are due now rather than at the old schedule's next deadline
+    {
+        std::lock_guard<std::mutex> lock(schedule_mutex);
+    }
+    schedule_cv.notify_all();
 }
 
-void PriceManager::AddToWatchlist(const std::string& coinId) {
-    std::lock_guard<std::mutex> lock(data_mutex);
+bool PriceManager::LoadCoinUniverse() {
+    try {
+        ResponseBuffer buffer(1024 * 1024);
+        if (!transport->Get(config.api_endpoint, "/api/v3/coins/list", buffer)) {
+            if (config.log_to_console) {
+                std::cerr << "Failed to fetch coin list" << std::endl;
+            }
+            return false;
+        }
+
+        std::string_view body = buffer.View();
+        json list = json::parse(body.begin(), body.end());
+
+        std::vector<CoinInfo> universe;
+        universe.reserve(list.size());
+        for (const auto& entry : list) {
+            std::string symbol = entry.value("symbol", "");
+            std::transform(symbol.begin(), symbol.end(), symbol.begin(), ::toupper);
+            universe.emplace_back(entry.value("id", ""), symbol, entry.value("name", ""));
+        }
 
-    for (auto& coin : coins) {
-        if (coin.id == coinId) {
-            coin.in_watchlist = true;
-            break;
+        if (universe.empty()) {
+            return false;
+        }
+
+        size_t count = universe.size();
+        SetTrackedCoins(universe);
+
+        if (config.log_to_console) {
+            std::cout << "Tracking " << count << " coins" << std::endl;
+        }
+        return true;
+    }
+    catch (const std::exception& e) {
+        if (config.log_to_console) {
+            std::cerr << "Error loading coin list: " << e.what() << std::endl;
         }
+        return false;
     }
-    // Don't save here - will save on app close
 }
 
-void PriceManager::RemoveFromWatchlist(const std::string& coinId) {
+std::shared_future<bool> PriceManager::UpdatePrices() {
+    if (!update_thread.joinable()) {
+        std::promise<bool> done;
+        done.set_value(FetchPricesFromAPI(true));
+        return done.get_future().share();
+    }
+
+    std::shared_future<bool> result;
+    bool queued = false;
+    {
+        std::lock_guard<std::mutex> lock(schedule_mutex);
+        if (running_future.valid()) {
+            return running_future;      // Join the fetch already on the wire
+        }
+        if (!refresh_requested) {
+            refresh_promise = std::promise<bool>();
+            refresh_future = refresh_promise.get_future().share();
+            refresh_requested = true;
+            queued = !update_in_progress.exchange(true, std::memory_order_relaxed);
+        }
+        result = refresh_future;
+    }
+    schedule_cv.notify_all();
+    if (queued) {
+        NotifyStatusChanged();
+    }
+    return result;
+}
+
+void PriceManager::SetUpdateInterval(std::chrono::milliseconds interval) {
+    {
+        std::lock_guard<std::mutex> lock(schedule_mutex);
+        update_interval = interval;
+    }
+    schedule_cv.notify_all();   // Re-evaluate the deadline
+}
+
+std::chrono::milliseconds PriceManager::GetUpdateInterval() {
+    std::lock_guard<std::mutex> lock(schedule_mutex);
+    return update_interval;
+}
+
+FetchStats PriceManager::GetLastFetchStats() {
     std::lock_guard<std::mutex> lock(data_mutex);
+    return last_fetch_stats;
+}
+
+StreamStats PriceManager::GetStreamStats() {
+    std::lock_guard<std::mutex> lock(data_mutex);
+    return stream_stats;
+}
 
-    for (auto& coin : coins) {
-        if (coin.id == coinId) {
-            coin.in_watchlist = false;
-            break;
+std::vector<ProviderStats> PriceManager::GetProviderStats() {
+    std::lock_guard<std::mutex> lock(data_mutex);
+    return provider_stats;
+}
+
+uint64_t PriceManager::AddAlert(const AlertRule& rule) {
+    std::shared_ptr<const CoinSnapshot> current = GetSnapshot();
+    if (current->store.Catalog().Index().FindById(rule.coin_id) == CoinIndex::NOT_FOUND) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(alert_mutex);
+    uint64_t id = alerts.Add(rule, &current->store);
+    if (id != 0) {
+        alert_version.fetch_add(1, std::memory_order_release);
+        if (!alert_thread.joinable() && !should_stop.load()) {
+            alert_thread = std::thread(&PriceManager::AlertThreadFunc, this);
         }
     }
-    // Don't save here - will save on app close
+    return id;
+}
+
+bool PriceManager::RemoveAlert(uint64_t id) {
+    std::lock_guard<std::mutex> lock(alert_mutex);
+    if (!alerts.Remove(id)) return false;
+    alert_version.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+std::vector<AlertInfo> PriceManager::GetAlerts() {
+    std::lock_guard<std::mutex> lock(alert_mutex);
+    return alerts.Alerts();
+}
+
+std::vector<AlertEvent> PriceManager::GetAlertLog() {
+    std::lock_guard<std::mutex> lock(alert_mutex);
+    return std::vector<AlertEvent>(alerts.Log().begin(), alerts.Log().end());
+}
+
+AlertStats PriceManager::GetAlertStats() {
+    std::lock_guard<std::mutex> lock(alert_mutex);
+    return alerts.Stats();
+}
+
+void PriceManager::AlertThreadFunc() {
+    std::shared_ptr<TickQueue> queue;
+    std::vector<PriceUpdate> updates;
+
+    while (!should_stop.load()) {
+        if (!queue || queue->Closed()) {
+            // Whatever a closed queue still holds refers to the old coin list.
+            // Seed from a snapshot taken before subscribing, so queued ticks
+            // are never already in the seed (ticks are queued before their
+            // snapshot is published); a tick missed in between only moves
+            // the value the next one crosses from.
+            std::shared_ptr<const CoinSnapshot> current = GetSnapshot();
+            queue = SubscribeTicks(config.alerts.queue_capacity);
+            std::lock_guard<std::mutex> lock(alert_mutex);
+            alerts.Bind(queue->CatalogPtr(), &current->store);
+        }
+
+        // Ticks are queued before their snapshot is published, so nothing
+        // queued after this version is read can be missed by the wait below
+        uint64_t seen = GetDataVersion();
+        if (queue->Drain(updates) > 0) {
+            bool changed;
+            {
+                std::lock_guard<std::mutex> lock(alert_mutex);
+                uint64_t revision = alerts.Revision();
+                for (const PriceUpdate& update : updates) {
+                    alerts.Evaluate(update);
+                }
+                changed = alerts.Revision() != revision;
+            }
+            if (changed) {
+                alert_version.fetch_add(1, std::memory_order_release);
+                NotifyStatusChanged();
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(notify_mutex);
+        data_changed_cv.wait(lock, [&] {
+            return should_stop.load() || data_version.load(std::memory_order_acquire) != seen;
+        });
+    }
 }
 
-void PriceManager::UpdatePrices() {
-    FetchPricesFromAPI();
+RefreshStats PriceManager::GetRefreshStats() {
+    std::lock_guard<std::mutex> lock(data_mutex);
+    return refresh_stats;
 }
 
 std::string PriceManager::GetLastUpdateTime() const {
-    return last_update_time;
+    return GetSnapshot()->last_update_time;
 }
 
 void PriceManager::UpdateThreadFunc() {
-    // Perform initial update
-    FetchPricesFromAPI();
+    // Switch to the full coin list first; keeps the defaults on failure
+    if (config.track_full_universe) {
+        LoadCoinUniverse();
+    }
+
+    std::unique_lock<std::mutex> lock(schedule_mutex);
+    bool first = true;
 
     // Loop until stop signal
     while (!should_stop.load()) {
-        // Sleep for UPDATE_INTERVAL_SEC seconds
-        for (int i = 0; i < UPDATE_INTERVAL_SEC && !should_stop.load(); ++i) {
-            std::this_thread::sleep_for(std::chrono::seconds(1));
+        // Sleep until the deadline or a refresh request / stop; the deadline is
+        // recomputed after every wake-up so interval changes apply at once.
+        // While the ticker stream is up it keeps pushing the deadlines of the
+        // coins it covers back, so only the others come due.
+        while (!first && !should_stop.load() && !refresh_requested) {
+            // Wake when the next coin falls due and a request budget allows it;
+            // a fixed schedule also follows interval changes at once
+            bool fixed = !config.refresh.adaptive && !streaming.load();
+            auto deadline = std::max(next_refresh_due.load(), last_update_start + MIN_FETCH_GAP);
+            if (fixed) {
+                deadline = std::min(deadline, last_update_start + update_interval);
+            }
+            if (deadline == std::chrono::steady_clock::time_point::max()) {
+                schedule_cv.wait(lock);     // No coins to refresh
+                continue;
+            }
+            if (std::chrono::steady_clock::now() >= deadline) break;
+            schedule_cv.wait_until(lock, deadline);
         }
+        if (should_stop.load()) break;
+
+        // On-demand refreshes, the first one and the ticks of a fixed schedule
+        // (without a stream) cover every coin; the others only the coins that are due
+        bool all_coins = first || refresh_requested || (!config.refresh.adaptive && !streaming.load() &&
+            std::chrono::steady_clock::now() >= last_update_start + update_interval);
 
-        if (!should_stop.load()) {
-            FetchPricesFromAPI();
+        // Scheduled refreshes get a promise too so callers can join them
+        if (!refresh_requested) {
+            refresh_promise = std::promise<bool>();
+            refresh_future = refresh_promise.get_future().share();
         }
+        std::promise<bool> round = std::move(refresh_promise);
+        running_future = std::move(refresh_future);
+        refresh_future = std::shared_future<bool>();
+        refresh_requested = false;
+        update_in_progress.store(true, std::memory_order_relaxed);
+
+        first = false;
+        last_update_start = std::chrono::steady_clock::now();
+
+        lock.unlock();
+        NotifyStatusChanged();
+        bool ok = FetchPricesFromAPI(all_coins);
+        lock.lock();
+
+        running_future = std::shared_future<bool>();
+        update_in_progress.store(refresh_requested, std::memory_order_relaxed);
+        round.set_value(ok);
+
+        // Updating/connection state changed even if no snapshot was published
+        lock.unlock();
+        NotifyStatusChanged();
+        lock.lock();
+    }
+
+    // Release anyone waiting on a refresh that will never run
+    if (refresh_requested) {
+        refresh_requested = false;
+        refresh_promise.set_value(false);
     }
+    update_in_progress.store(false, std::memory_order_relaxed);
 }
 
-bool PriceManager::FetchPricesFromAPI() {
-    try {
-        // Build comma-separated list of coin IDs
-        std::string ids;
-        {
-            std::lock_guard<std::mutex> lock(data_mutex);
-            for (size_t i = 0; i < coins.size(); ++i) {
-                ids += coins[i].id;
-                if (i < coins.size() - 1) ids += ",";
+void PriceManager::CreateProviders() {
+    // Without a provider list the API endpoint is the only source and
+    // shares the main transport, as before providers existed
+    if (config.providers.empty()) {
+        providers.push_back(std::make_unique<PriceProvider>(
+            PriceProviderConfig{ "default", config.api_endpoint, 1.0, std::chrono::milliseconds(0), config.api_budget },
+            transport));
+    }
+    for (const auto& provider_config : config.providers) {
+        std::unique_ptr<HttpTransport> provider_transport = config.provider_transport_factory
+            ? config.provider_transport_factory() : CreateDefaultTransport();
+        providers.push_back(std::make_unique<PriceProvider>(provider_config, std::move(provider_transport)));
+    }
+
+    for (const auto& provider : providers) {
+        ProviderStats stats;
+        stats.name = provider->Config().name;
+        provider_stats.push_back(std::move(stats));
+    }
+}
+
+void PriceManager::FetchProviders(std::vector<ProviderResult>& results, std::vector<char>& merged) {
+    const CoinIndex& index = store.Catalog().Index();
+    size_t count = providers.size();
+    results.assign(count, ProviderResult());
+    merged.assign(count, 0);
+    for (auto& provider : providers) {
+        provider->ClearCancel();
+    }
+
+    // A single provider without a timeout has nothing to race against
+    if (count == 1 && providers[0]->Config().timeout.count() <= 0) {
+        results[0] = providers[0]->Fetch(fetch_batches, index, config.max_concurrent_requests, should_stop);
+        merged[0] = results[0].sent > results[0].failed_batches;
+        return;
+    }
+
+    size_t quorum = ProviderQuorum();
+    std::mutex round_mutex;
+    std::condition_variable round_cv;
+    std::vector<char> finished(count, 0);       // Fetch returned (guarded by round_mutex)
+    std::vector<char> cut_off(count, 0);        // Timed out or no longer needed
+
+    // Each provider fetches the batches into its own staging on its own thread
+    std::vector<std::thread> pool;
+    for (size_t p = 0; p < count; ++p) {
+        pool.emplace_back([&, p] {
+            ProviderResult result = providers[p]->Fetch(fetch_batches, index, config.max_concurrent_requests, should_stop);
+            std::lock_guard<std::mutex> lock(round_mutex);
+            results[p] = std::move(result);
+            finished[p] = 1;
+            round_cv.notify_one();
+        });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        std::unique_lock<std::mutex> lock(round_mutex);
+        while (true) {
+            auto now = std::chrono::steady_clock::now();
+            auto next_deadline = std::chrono::steady_clock::time_point::max();
+            size_t answered = 0, pending = 0;
+            for (size_t p = 0; p < count; ++p) {
+                if (cut_off[p]) continue;
+                if (finished[p]) {
+                    answered += results[p].sent > results[p].failed_batches;
+                    continue;
+                }
+
+                std::chrono::milliseconds timeout = providers[p]->Config().timeout;
+                if (timeout.count() > 0) {
+                    auto deadline = start + timeout;
+                    if (now >= deadline) {
+                        cut_off[p] = 1;
+                        providers[p]->Cancel();
+                        continue;
+                    }
+                    next_deadline = std::min(next_deadline, deadline);
+                }
+                ++pending;
+            }
+            if (answered >= quorum || pending == 0) break;
+
+            if (next_deadline == std::chrono::steady_clock::time_point::max()) {
+                round_cv.wait(lock);
+            }
+            else {
+                round_cv.wait_until(lock, next_deadline);
             }
         }
 
-        // Build request path
-        std::string pathStr = "/api/v3/simple/price?ids=" + ids +
-            "&vs_currencies=usd&include_24hr_change=true";
-        std::wstring path(pathStr.begin(), pathStr.end());
+        // The consensus uses whoever answered by now; stragglers are dropped
+        for (size_t p = 0; p < count; ++p) {
+            if (finished[p] && !cut_off[p]) {
+                merged[p] = results[p].sent > results[p].failed_batches;
+            }
+            else if (!cut_off[p]) {
+                cut_off[p] = 1;
+                providers[p]->Cancel();
+            }
+        }
+    }
 
-        // Make HTTP request using WinHTTP
-        std::string responseBody = HttpGet(L"api.coingecko.com", path);
+    // Cancelled fetches return as soon as their sockets are shut down
+    for (auto& t : pool) {
+        t.join();
+    }
+    for (size_t p = 0; p < count; ++p) {
+        if (cut_off[p]) {
+            results[p].cut_off = true;
+            results[p].error = "Cut off";
+        }
+    }
+}
 
-        if (responseBody.empty()) {
-            std::cerr << "HTTP request failed!" << std::endl;
-            is_connected.store(false);
+size_t PriceManager::ProviderQuorum() const {
+    if (config.provider_quorum > 0) {
+        return std::min(config.provider_quorum, providers.size());
+    }
+    return providers.size() / 2 + 1;
+}
+
+bool PriceManager::FetchPricesFromAPI(bool all_coins) {
+    // Background and manual updates share the providers and staging
+    std::lock_guard<std::mutex> fetch_lock(fetch_mutex);
+
+    try {
+        FetchStats stats;
+        if (store.Size() == 0) {
             return false;
         }
 
-        // Parse JSON response
-        json data = json::parse(responseBody);
+        // Take the coins that are due; watchlist coins come round more often
+        auto fetch_start = std::chrono::steady_clock::now();
+        std::shared_ptr<const CoinSnapshot> current = GetSnapshot();
+        if (current->store.CatalogPtr() == store.CatalogPtr()) {
+            refresh.SetWatchlist(current->watchlist);
+        }
+        refresh.SetBaseInterval(GetUpdateInterval());
+        refresh.PopDue(fetch_start + DUE_WINDOW, all_coins, due_slots);
+        stats.coins_due = due_slots.size();
+        if (due_slots.empty()) {
+            next_refresh_due.store(refresh.NextDue());
+            return true;
+        }
+        fetch_batches = FetchPlanner::Plan(store.Catalog(), due_slots, config.max_request_path);
 
-        // Update coin prices
-        {
-            std::lock_guard<std::mutex> lock(data_mutex);
+        std::vector<ProviderResult> results;
+        std::vector<char> merged;
+        FetchProviders(results, merged);
+        stats.request_us = MicrosecondsSince(fetch_start);
 
-            for (auto& coin : coins) {
-                if (data.contains(coin.id)) {
-                    auto coin_data = data[coin.id];
+        // Cancelled by shutdown: failures are expected, keep the last state
+        if (should_stop.load()) {
+            return false;
+        }
 
-                    if (coin_data.contains("usd")) {
-                        coin.price = coin_data["usd"].get<double>();
-                    }
+        std::vector<const std::vector<StagedQuote>*> sources;
+        std::vector<double> weights;
+        for (size_t p = 0; p < providers.size(); ++p) {
+            stats.batches += results[p].sent;
+            stats.batches_skipped += results[p].skipped;
+            stats.failed_batches += results[p].failed_batches;
+            stats.parse_us += results[p].parse_us;
+            if (merged[p]) {
+                sources.push_back(&providers[p]->Staging());
+                weights.push_back(providers[p]->Config().weight);
+            }
+            bool failed = results[p].failed_batches > 0 || results[p].cut_off || results[p].sent == 0;
+            if (failed && config.log_to_console) {
+                std::cerr << "Error fetching prices from " << providers[p]->Config().name << ": "
+                    << results[p].error << std::endl;
+            }
+        }
+        stats.providers_merged = sources.size();
+        stats.quorum_met = sources.size() >= ProviderQuorum();
 
-                    if (coin_data.contains("usd_24h_change")) {
-                        coin.change_24h = coin_data["usd_24h_change"].get<double>();
-                    }
+        if (!sources.empty()) {
+            // Slots any answering provider quoted
+            MergeQuotes(sources, weights, config.consensus, staging, commit_slots);
+
+            CommitOutcome committed = CommitQuotes(staging, commit_slots, std::chrono::system_clock::now());
+            stats.coins_updated = committed.coins_updated;
+            stats.coins_changed = committed.coins_changed;
+            stats.lock_hold_us = committed.lock_hold_us;
+        }
+
+        // Coins of a batch some merged provider fetched are due again one
+        // (freshly estimated) interval after this fetch started; the others
+        // keep their deadline and go first next time
+        for (size_t b = 0; b < fetch_batches.size(); ++b) {
+            bool fetched = false;
+            for (size_t p = 0; p < providers.size(); ++p) {
+                fetched |= merged[p] && results[p].batch_ok[b];
+            }
+            for (uint32_t slot : fetch_batches[b].slots) {
+                if (fetched) {
+                    refresh.Schedule(slot, fetch_start);
+                }
+                else {
+                    refresh.Retry(slot);
                 }
             }
+        }
 
-            // Update timestamp
-            auto now = std::chrono::system_clock::now();
-            auto time = std::chrono::system_clock::to_time_t(now);
-            std::stringstream ss;
-            ss << std::put_time(std::localtime(&time), "%H:%M:%S");
-            last_update_time = ss.str();
+        // Coins already overdue go out as soon as a request budget allows
+        auto now = std::chrono::steady_clock::now();
+        auto next_due = refresh.NextDue();
+        if (next_due <= now) {
+            auto available = std::chrono::steady_clock::time_point::max();
+            for (const auto& provider : providers) {
+                available = std::min(available, provider->Budget().NextAvailable(now));
+            }
+            next_due = std::max(next_due, available);
+        }
+        next_refresh_due.store(next_due);
+        RefreshStats spread = refresh.Stats(now);
+        stats.max_staleness_ms = spread.max_age_ms;
+
+        {
+            std::lock_guard<std::mutex> lock(data_mutex);
+            for (size_t p = 0; p < providers.size(); ++p) {
+                ProviderStats& counters = provider_stats[p];
+                ++counters.rounds;
+                counters.merged += merged[p];
+                counters.failed += results[p].failed_batches > 0 && !results[p].cut_off;
+                counters.cut_off += results[p].cut_off;
+                if (merged[p]) {
+                    counters.last_request_ms = results[p].request_us / 1000.0;
+                }
+                counters.budget = providers[p]->Budget().Stats();
+            }
+            last_fetch_stats = stats;
+            refresh_stats = spread;
+        }
+
+        if (sources.empty()) {
+            is_connected.store(false);
+            return false;
         }
 
         is_connected.store(true);
-        std::cout << "Prices updated successfully at " << last_update_time << std::endl;
+        if (config.log_to_console) {
+            std::cout << "Prices updated successfully at " << GetLastUpdateTime() << std::endl;
+        }
         return true;
 
     }
     catch (const std::exception& e) {
-        std::cerr << "Error fetching prices: " << e.what() << std::endl;
+        if (config.log_to_console) {
+            std::cerr << "Error fetching prices: " << e.what() << std::endl;
+        }
         is_connected.store(false);
         return false;
     }
 }
 
+PriceManager::CommitOutcome PriceManager::CommitQuotes(const std::vector<StagedQuote>& quotes,
+    const std::vector<uint32_t>& slots, std::chrono::system_clock::time_point now) {
+    CommitOutcome outcome;
+    int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        now.time_since_epoch()).count();
+
+    // Compare with the current snapshot; it holds the same prices as 'store'
+    // because only fetch_mutex holders write them. Values that did not move
+    // beyond the epsilons are left as they are.
+    std::shared_ptr<const CoinSnapshot> base = GetSnapshot();
+    const CoinStore& current = base->store;
+    std::vector<uint32_t> changed;
+    auto observed = std::chrono::steady_clock::now();
+    for (uint32_t i : slots) {
+        const StagedQuote& quote = quotes[i];
+        uint8_t moved = 0;
+        if (quote.fields & StagedQuote::HAS_PRICE) {
+            ++outcome.coins_updated;
+            refresh.Observe(i, quote.price, observed);     // Unchanged prices are volatility data too
+            if (!current.IsPriced(i) ||
+                std::fabs(quote.price - current.Price(i)) > config.price_epsilon * std::fabs(current.Price(i))) {
+                moved |= StagedQuote::HAS_PRICE;
+            }
+        }
+        if ((quote.fields & StagedQuote::HAS_CHANGE) &&
+            !(std::fabs(quote.change_24h - current.Change(i)) <= config.change_epsilon)) {
+            moved |= StagedQuote::HAS_CHANGE;
+        }
+        if (moved) {
+            moved_fields[i] = moved;
+            changed.push_back(i);
+        }
+    }
+    outcome.coins_changed = changed.size();
+
+    // Apply the moved fields to a coin store
+    auto apply_quotes = [&](CoinStore& target) {
+        for (uint32_t i : changed) {
+            if (moved_fields[i] & StagedQuote::HAS_PRICE) {
+                target.SetPrice(i, quotes[i].price, now_ms);
+            }
+            if (moved_fields[i] & StagedQuote::HAS_CHANGE) {
+                target.SetChange(i, quotes[i].change_24h);
+            }
+        }
+    };
+
+    // Record the ticks outside data_mutex and before publishing, so a reader woken by
+    // the new snapshot already finds them; readers of the history never lock
+    std::shared_ptr<PriceHistory> rings = history.load();
+    std::vector<TickRecord> ticks;
+    if (tick_log) {
+        ticks.reserve(changed.size());
+    }
+    for (uint32_t i : changed) {
+        if (moved_fields[i] & StagedQuote::HAS_PRICE) {
+            rings->Append(i, now_ms, quotes[i].price);
+            if (tick_log) {
+                ticks.push_back({ now_ms, quotes[i].price, tick_keys[i] });
+            }
+        }
+    }
+
+    // Written and synced by the log's own thread
+    if (tick_log) {
+        tick_log->Append(std::move(ticks));
+    }
+
+    // Consumers whose last reference is gone have unsubscribed
+    std::erase_if(tick_queues, [](const std::shared_ptr<TickQueue>& queue) { return queue.use_count() == 1; });
+    if (!tick_queues.empty()) {
+        for (uint32_t i : changed) {
+            PriceUpdate update;
+            update.timestamp_ms = now_ms;
+            update.price = (moved_fields[i] & StagedQuote::HAS_PRICE) ? quotes[i].price : current.Price(i);
+            update.change_24h = (moved_fields[i] & StagedQuote::HAS_CHANGE) ? quotes[i].change_24h : current.Change(i);
+            update.slot = i;
+            update.fields = moved_fields[i];
+            for (auto& queue : tick_queues) {
+                queue->Push(update);
+            }
+        }
+    }
+
+    // Prepare the next snapshot outside the lock from the current one;
+    // only prices change here, so it matches 'store' unless someone
+    // published in between (checked below)
+    auto next = std::make_shared<CoinSnapshot>(*base);
+    apply_quotes(next->store);
+    std::vector<uint32_t> published = changed;
+    std::sort(published.begin(), published.end());
+
+    {
+        // Merge in one short critical section
+        std::lock_guard<std::mutex> lock(data_mutex);
+        auto lock_start = std::chrono::steady_clock::now();
+
+        apply_quotes(store);
+
+        // Update timestamp
+        auto time = std::chrono::system_clock::to_time_t(now);
+        std::stringstream ss;
+        ss << std::put_time(std::localtime(&time), "%H:%M:%S");
+        last_update_time = ss.str();
+
+        if (base->version == data_version.load(std::memory_order_relaxed)) {
+            next->last_update_time = last_update_time;
+            next->changes = CoinChanges();
+            next->changes.slots = std::move(published);
+            PublishSnapshot(std::move(next));
+        }
+        else {
+            PublishSnapshot(std::move(published));
+        }
+
+        outcome.lock_hold_us = MicrosecondsSince(lock_start);
+    }
+
+    for (uint32_t i : changed) {
+        moved_fields[i] = 0;
+    }
+    return outcome;
+}
+
+void PriceManager::SetStreamConnected(bool connected, StreamStats& counters) {
+    {
+        std::lock_guard<std::mutex> lock(schedule_mutex);
+        streaming.store(connected);
+    }
+    schedule_cv.notify_all();   // Switches a fixed schedule between all coins and due coins
+
+    counters.connected = connected;
+    if (connected) {
+        ++counters.connects;
+        is_connected.store(true);
+    }
+    else {
+        ++counters.disconnects;
+    }
+    {
+        std::lock_guard<std::mutex> lock(data_mutex);
+        stream_stats = counters;
+    }
+    NotifyStatusChanged();
+
+    if (config.log_to_console) {
+        if (connected) {
+            std::cout << "Streaming prices from " << config.stream_endpoint.host << std::endl;
+        }
+        else {
+            std::cerr << "Price stream disconnected; polling until it is back" << std::endl;
+        }
+    }
+}
+
+bool PriceManager::ApplyStreamBatch(const std::shared_ptr<const CoinCatalog>& catalog,
+    std::vector<StagedQuote>& quotes, std::vector<uint32_t>& dirty, int64_t newest_event_ms,
+    StreamStats& counters) {
+    bool current;
+    {
+        // Serializes with fetches and coin-list changes, like a fetch
+        std::lock_guard<std::mutex> fetch_lock(fetch_mutex);
+        current = store.CatalogPtr() == catalog;
+        if (current) {
+            auto now = std::chrono::system_clock::now();
+            CommitOutcome committed = CommitQuotes(quotes, dirty, now);
+
+            // Streamed coins need no poll until their next interval is up; the
+            // deadlines only move later, so the update thread can sleep longer
+            auto observed = std::chrono::steady_clock::now();
+            for (uint32_t slot : dirty) {
+                if (quotes[slot].fields & StagedQuote::HAS_PRICE) {
+                    refresh.Schedule(slot, observed);
+                }
+            }
+            next_refresh_due.store(std::max(next_refresh_due.load(), refresh.NextDue()));
+            ++counters.batches;
+            counters.last_batch_coins = committed.coins_updated;
+            counters.last_batch_lock_us = committed.lock_hold_us;
+            if (newest_event_ms > 0) {
+                int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    now.time_since_epoch()).count();
+                counters.last_event_lag_ms = static_cast<double>(now_ms - newest_event_ms);
+            }
+        }
+    }
+
+    for (uint32_t slot : dirty) {
+        quotes[slot].fields = 0;
+    }
+    dirty.clear();
+
+    is_connected.store(true);
+    std::lock_guard<std::mutex> lock(data_mutex);
+    stream_stats = counters;
+    return current;
+}
+
+void PriceManager::StreamThreadFunc() {
+    ResponseBuffer message;
+    std::shared_ptr<const CoinCatalog> catalog;     // Coin list the slots below refer to
+    std::vector<StagedQuote> quotes;                // Latest ticker fields per slot since the last batch
+    std::vector<uint32_t> dirty;                    // Slots of 'quotes' with pending fields
+    std::unique_ptr<TickerSymbolMap> symbols;       // Ticker symbol -> slot of 'catalog'
+    StreamStats counters;
+
+    auto bind_catalog = [&] {
+        catalog = GetSnapshot()->store.CatalogPtr();
+        symbols = std::make_unique<TickerSymbolMap>(*catalog, config.stream_symbols);
+        quotes.assign(catalog->Size(), StagedQuote());
+        dirty.clear();
+    };
+
+    while (!should_stop.load()) {
+        std::unique_ptr<WebSocket> socket = transport->OpenWebSocket(config.stream_endpoint, config.stream_path);
+
+        // Re-checked after the handshake: shutdown may have cancelled transfers just before it
+        if (socket && !should_stop.load()) {
+            bind_catalog();
+            SetStreamConnected(true, counters);
+
+            int64_t newest_event_ms = 0;
+            auto batch_deadline = std::chrono::steady_clock::now();
+            while (!should_stop.load()) {
+                // Hold updates until the batch is due, then apply them together
+                auto timeout = STREAM_IDLE_WAIT;
+                if (!dirty.empty()) {
+                    timeout = std::max(std::chrono::milliseconds(0),
+                        std::chrono::duration_cast<std::chrono::milliseconds>(
+                            batch_deadline - std::chrono::steady_clock::now()));
+                }
+
+                WebSocket::Status status = socket->Receive(message, timeout);
+                if (status == WebSocket::Status::Closed) break;
+
+                if (status == WebSocket::Status::Message) {
+                    ++counters.messages;
+                    bool batch_empty = dirty.empty();
+
+                    // Pick up a coin-list change before starting a new batch
+                    if (batch_empty && GetSnapshot()->store.CatalogPtr() != catalog) {
+                        bind_catalog();
+                    }
+                    TickerParseResult parsed = TickerStreamParser::Parse(message.View(), *symbols,
+                        config.stream_quote_asset, quotes, dirty);
+                    if (!parsed.ok) {
+                        ++counters.bad_messages;
+                    }
+                    counters.tickers += parsed.tickers;
+                    newest_event_ms = std::max(newest_event_ms, parsed.newest_event_ms);
+                    if (batch_empty && !dirty.empty()) {
+                        batch_deadline = std::chrono::steady_clock::now() + config.stream_batch_interval;
+                    }
+                }
+
+                if (!dirty.empty() && (status == WebSocket::Status::Timeout ||
+                    std::chrono::steady_clock::now() >= batch_deadline)) {
+                    if (!ApplyStreamBatch(catalog, quotes, dirty, newest_event_ms, counters)) {
+                        bind_catalog();     // Coin list changed; resolve symbols against the new one
+                    }
+                    newest_event_ms = 0;
+                }
+            }
+
+            if (!dirty.empty() && !should_stop.load()) {
+                ApplyStreamBatch(catalog, quotes, dirty, newest_event_ms, counters);
+            }
+            SetStreamConnected(false, counters);
+        }
+        socket.reset();
+
+        std::unique_lock<std::mutex> lock(schedule_mutex);
+        schedule_cv.wait_for(lock, config.stream_reconnect_delay, [&] { return should_stop.load(); });
+    }
+}
+
 void PriceManager::SaveWatchlist() {
     try {
         if (!fs::exists("data")) {
@@ -278,10 +1108,8 @@ void PriceManager::SaveWatchlist() {
 
         std::lock_guard<std::mutex> lock(data_mutex);
 
-        for (const auto& coin : coins) {
-            if (coin.in_watchlist) {
-                watchlist_json.push_back(coin.id);
-            }
+        for (size_t index : store.WatchlistIndices()) {
+            watchlist_json.push_back(store.Catalog().Id(index));
         }
 
         std::ofstream file("data/watchlist.json");
@@ -316,14 +1144,7 @@ void PriceManager::LoadWatchlist() {
         std::lock_guard<std::mutex> lock(data_mutex);
 
         for (const auto& coin_id : watchlist_json) {
-            std::string id = coin_id.get<std::string>();
-
-            for (auto& coin : coins) {
-                if (coin.id == id) {
-                    coin.in_watchlist = true;
-                    break;
-                }
-            }
+            SetWatchlistFlag(coin_id.get_ref<const std::string&>(), true);
         }
 
         std::cout << "Watchlist loaded successfully" << std::endl;
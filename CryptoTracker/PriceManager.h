@@ -5,16 +5,115 @@
 #include <mutex>
 #include <atomic>
 #include <thread>
+#include <memory>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <condition_variable>
 #include "Coin.h"
+#include "HttpTransport.h"
+#include "PriceResponseParser.h"
+#include "PriceProvider.h"
+#include "TickerStreamParser.h"
+#include "CoinStore.h"
+#include "FetchPlanner.h"
+#include "RefreshScheduler.h"
+#include "CoinSnapshot.h"
+#include "PriceHistory.h"
+#include "TickLog.h"
+#include "TickQueue.h"
+#include "AlertEngine.h"
+
+/**
+ * @brief Runtime options for PriceManager
+ */
+struct PriceManagerConfig {
+    HttpEndpoint api_endpoint{ "api.coingecko.com", 80 }; // Price API server (used when 'providers' is empty)
+    RequestBudgetConfig api_budget;             // Rate limit towards api_endpoint (when 'providers' is empty)
+    std::vector<PriceProviderConfig> providers; // Price sources polled concurrently and merged per coin
+    size_t provider_quorum = 0;                 // Providers that must answer before prices are applied (0 = majority)
+    ConsensusMethod consensus = ConsensusMethod::Median; // How the providers' quotes are merged
+    std::function<std::unique_ptr<HttpTransport>()> provider_transport_factory; // Transport per provider (default: CreateDefaultTransport)
+    bool start_update_thread = true;            // Spawn the periodic background updater
+    bool persist_watchlist = true;              // Load/save data/watchlist.json
+    bool log_to_console = true;                 // Print status messages to stdout/stderr
+    bool track_full_universe = false;           // Replace the default 20 coins with /coins/list on startup
+    size_t max_request_path = 4000;             // Upper bound on one /simple/price request path
+    size_t max_concurrent_requests = 4;         // Batches fetched in parallel
+    std::chrono::milliseconds update_interval{ 30000 }; // Refresh interval of coins without volatility data (all coins unless refresh.adaptive)
+    RefreshPolicy refresh;                      // Per-coin refresh intervals from volatility and the watchlist
+    size_t history_capacity = 2880;             // Price samples kept per coin (24 h at 30 s)
+    size_t history_budget_bytes = 64 * 1024 * 1024; // Cap on the history arena; 15k coins keep 272 samples each
+    double price_epsilon = 0.0;                 // Relative price move a coin needs to count as changed (0 = any)
+    double change_epsilon = 0.0;                // 24h change move (percentage points) a coin needs to count as changed
+    bool persist_ticks = true;                  // Append every changed price to the on-disk tick log
+    std::string tick_log_directory = "data/ticks"; // Segment files of the tick log
+    size_t tick_log_segment_bytes = 64 * 1024 * 1024; // Segment size at which it is sealed
+    size_t tick_log_max_bytes = 1024ull * 1024 * 1024; // Oldest segments are deleted beyond this
+    bool stream_prices = false;                 // Keep a WebSocket ticker subscription; poll only coins it does not refresh
+    HttpEndpoint stream_endpoint{ "stream.binance.com", 9443, true }; // Ticker stream server
+    std::string stream_path = "/ws/!ticker@arr"; // All-market 24h tickers
+    std::string stream_quote_asset = "USDT";    // Market whose tickers are applied ("BTCUSDT" -> BTC)
+    std::unordered_map<std::string, std::string> stream_symbols{    // Base symbol -> CoinGecko ID (others need a unique symbol)
+        { "BTC", "bitcoin" }, { "ETH", "ethereum" }, { "BNB", "binancecoin" },
+        { "SOL", "solana" }, { "XRP", "ripple" }, { "USDC", "usd-coin" }, { "ADA", "cardano" },
+        { "DOGE", "dogecoin" }, { "TRX", "tron" }, { "AVAX", "avalanche-2" }, { "DOT", "polkadot" },
+        { "LINK", "chainlink" }, { "SHIB", "shiba-inu" }, { "BCH", "bitcoin-cash" }, { "LTC", "litecoin" },
+        { "UNI", "uniswap" }, { "XLM", "stellar" }
+    };
+    std::chrono::milliseconds stream_batch_interval{ 100 }; // Longest time stream updates are held to batch them
+    std::chrono::milliseconds stream_reconnect_delay{ 5000 }; // Wait between connection attempts
+    AlertPolicy alerts;                         // Hysteresis and log size of price alerts
+};
+
+/**
+ * @brief Timings of the most recent price fetch
+ */
+struct FetchStats {
+    double request_us = 0.0;                    // Wall time of all batch requests + downloads
+    double parse_us = 0.0;                      // JSON parse time summed over batches (excluding network waits)
+    double lock_hold_us = 0.0;                  // Time data_mutex was held while applying prices
+    size_t coins_updated = 0;                   // Coins that received a price
+    size_t coins_changed = 0;                   // Coins whose price or change moved (the snapshot's change set)
+    size_t coins_due = 0;                       // Coins whose refresh deadline had passed
+    size_t batches = 0;                         // Requests issued
+    size_t batches_skipped = 0;                 // Requests the request budget held back
+    size_t failed_batches = 0;                  // Requests that failed or returned bad JSON
+    size_t providers_merged = 0;                // Providers whose quotes went into the consensus
+    bool quorum_met = false;                    // Enough providers answered before their timeouts
+    double max_staleness_ms = 0.0;              // Age of the oldest price (never-fetched coins aside)
+};
+
+/**
+ * @brief Counters of the ticker stream
+ */
+struct StreamStats {
+    bool connected = false;                     // Subscription is up (scheduled polling is paused)
+    uint64_t connects = 0;                      // Successful handshakes
+    uint64_t disconnects = 0;                   // Subscriptions lost (polling took over)
+    uint64_t messages = 0;                      // Messages received
+    uint64_t tickers = 0;                       // Ticker entries for tracked coins
+    uint64_t bad_messages = 0;                  // Messages that failed to parse
+    uint64_t batches = 0;                       // Batches applied
+    size_t last_batch_coins = 0;                // Coins updated by the last batch
+    double last_batch_lock_us = 0.0;            // Time data_mutex was held for the last batch
+    double last_event_lag_ms = 0.0;             // Apply time minus the newest exchange event time of the last batch
+};
 
 /**
  * @brief Manages cryptocurrency price data and API interactions
  *
  * This class handles:
- * - Fetching live price data from CoinGecko API using httplib
+ * - Fetching live price data from CoinGecko API through an HttpTransport
+ * - Merging several price providers into a consensus price once a quorum answers
  * - Managing the list of available coins
- * - Background thread for periodic price updates
+ * - Background scheduler thread for periodic and on-demand price updates
+ * - Refreshing each coin at an interval set by its volatility and watchlist membership
+ * - Pacing requests per provider (token bucket, Retry-After, backoff with jitter)
+ * - Optional WebSocket ticker stream; coins it does not refresh in time are still polled
  * - Thread-safe access to shared price data using mutex
+ * - Publishing immutable CoinSnapshots for lock-free readers
+ * - Recording a bounded per-coin price history and persisting every tick
  * - Saving/loading user's watchlist to/from file using fstream
  */
 class PriceManager {
@@ -24,39 +123,229 @@ public:
      */
     PriceManager();
 
+    /**
+     * @brief Constructor with an explicit transport and options
+     * @param transport HTTP client used for all API requests
+     * @param config Endpoint, threading and persistence options
+     */
+    PriceManager(std::unique_ptr<HttpTransport> transport, const PriceManagerConfig& config);
+
     /**
      * @brief Destructor stops background thread and cleans up
      */
     ~PriceManager();
 
     /**
-     * @brief Get reference to all coins (thread-safe)
-     * @return Vector of all available coins
+     * @brief Get the latest published snapshot (lock-free, no copying)
+     * @return Shared pointer that stays valid for as long as it is held
+     */
+    std::shared_ptr<const CoinSnapshot> GetSnapshot() const { return snapshot.load(); }
+
+    /**
+     * @brief Monotonically increasing data version
+     *
+     * Bumped on every price update, watchlist edit and coin-list change;
+     * equals the version of the latest published snapshot. Cheap to poll
+     * every frame; re-fetch the snapshot or derived views only when it
+     * differs from the version already held.
+     */
+    uint64_t GetDataVersion() const { return data_version.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Block until the data version differs from 'seen_version'
+     * @param seen_version Version the caller already has
+     * @param timeout Maximum time to wait
+     * @return true if the data changed, false on timeout
+     */
+    bool WaitForDataChange(uint64_t seen_version, std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Register a callback invoked after every data or status change
+     *
+     * Fires after each snapshot publication and whenever IsUpdating(),
+     * IsConnected() or IsStreaming() may have changed (a refresh was queued
+     * or finished, the stream went up or down),
+     * so a UI that only renders on demand knows when to wake up. Called on
+     * the thread that made the change, possibly while data_mutex is held:
+     * keep it short (e.g. post a message or signal an event) and do not
+     * call back into PriceManager from it.
+     * @param callback Receives the current data version; empty to unregister
+     */
+    void SetDataChangedCallback(std::function<void(uint64_t)> callback);
+
+    /**
+     * @brief Get the price history of the current coin list (lock-free)
+     *
+     * Every price that moved is appended to its coin's ring. Read windows with
+     * PriceHistory::ReadWindow from any thread; the writer is never blocked.
+     * A coin-list change swaps in a new history (samples of coins kept in
+     * the list are carried over); a held pointer keeps reading the old one.
+     */
+    std::shared_ptr<const PriceHistory> GetPriceHistory() const { return history.load(); }
+
+    /**
+     * @brief Read a coin's persisted ticks (memory-mapped, survives restarts)
+     *
+     * Covers everything the tick log retains, not just the in-memory rings.
+     * The last few seconds may still be queued for the log writer.
+     * @param out Cleared, then filled oldest first
+     * @return Number of samples, 0 if persist_ticks is off
+     */
+    size_t ReadTickLog(std::string_view coin_id, int64_t from_ms, int64_t to_ms, std::vector<PriceSample>& out) const;
+
+    /**
+     * @brief Get segment and error counters of the tick log
+     */
+    TickLogStats GetTickLogStats() const { return tick_log ? tick_log->GetStats() : TickLogStats(); }
+
+    /**
+     * @brief Subscribe to the price updates of the current coin list
+     *
+     * Every fetch or stream batch pushes its changed coins (current price
+     * and change) into the returned queue before publishing the snapshot,
+     * so a consumer woken by WaitForDataChange() finds them. Delivery is
+     * lock-free and never waits on a consumer: one that falls behind gets
+     * only the latest update of each coin. The fetch path as a whole still
+     * locks (see CommitQuotes). A coin-list change closes the
+     * queue; drain it, then subscribe again. Dropping the last reference
+     * unsubscribes. May wait for a running fetch.
+     * @param capacity Updates the queue holds before it starts conflating
      */
-    std::vector<Coin>& GetCoins();
+    std::shared_ptr<TickQueue> SubscribeTicks(size_t capacity = 16384);
 
     /**
-     * @brief Get coins that are in the watchlist
-     * @return Vector of watchlist coins
+     * @brief Add a price or 24h change alert
+     *
+     * Alerts are evaluated on their own thread (started with the first
+     * alert) from a tick queue, so they never slow down a fetch.
+     * @return Alert ID, 0 if the coin is not tracked or the threshold is not a number
      */
-    std::vector<Coin> GetWatchlistCoins();
+    uint64_t AddAlert(const AlertRule& rule);
+
+    /**
+     * @brief Remove an alert
+     * @return false if the ID is unknown
+     */
+    bool RemoveAlert(uint64_t id);
+
+    /**
+     * @brief Get every alert and its state, by ID
+     */
+    std::vector<AlertInfo> GetAlerts();
+
+    /**
+     * @brief Get the triggered alerts, oldest first
+     */
+    std::vector<AlertEvent> GetAlertLog();
+
+    /**
+     * @brief Get alert counts and evaluation counters
+     */
+    AlertStats GetAlertStats();
+
+    /**
+     * @brief Changes whenever GetAlerts() or GetAlertLog() would (cheap, for UI polling)
+     */
+    uint64_t GetAlertVersion() const { return alert_version.load(std::memory_order_acquire); }
 
     /**
      * @brief Add a coin to the watchlist
      * @param coinId CoinGecko ID of the coin
      */
-    void AddToWatchlist(const std::string& coinId);
+    void AddToWatchlist(std::string_view coinId);
 
     /**
      * @brief Remove a coin from the watchlist
      * @param coinId CoinGecko ID of the coin
      */
-    void RemoveFromWatchlist(const std::string& coinId);
+    void RemoveFromWatchlist(std::string_view coinId);
+
+    /**
+     * @brief Replace the tracked coin list
+     *
+     * Watchlist membership is carried over for IDs present in both lists.
+     * @param new_coins Coins to track from now on
+     */
+    void SetTrackedCoins(const std::vector<CoinInfo>& new_coins);
+
+    /**
+     * @brief Track every coin listed by CoinGecko /coins/list
+     * @return true if the list was fetched and applied
+     */
+    bool LoadCoinUniverse();
+
+    /**
+     * @brief Request a price update (non-blocking, single-flight)
+     *
+     * Hands the refresh to the update thread and wakes it immediately.
+     * Callers arriving while a fetch is running share that fetch; callers
+     * arriving while one is queued share the queued one, so any number of
+     * clicks or concurrent callers cost at most one fetch at a time.
+     * Without an update thread (start_update_thread = false) the fetch runs
+     * on the calling thread and the returned future is already ready.
+     * @return Future that becomes true/false when the shared fetch finishes
+     *         (false as well if the manager shuts down first)
+     */
+    std::shared_future<bool> UpdatePrices();
+
+    /**
+     * @brief Whether a fetch is queued or running (cheap, for UI indicators)
+     */
+    bool IsUpdating() const { return update_in_progress.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Change the periodic refresh interval
+     *
+     * With RefreshPolicy::adaptive off every coin uses it, and the next
+     * refresh is moved to last start + new interval. Otherwise it applies
+     * to coins without volatility data from their next refresh on.
+     */
+    void SetUpdateInterval(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Get the periodic refresh interval
+     */
+    std::chrono::milliseconds GetUpdateInterval();
 
     /**
-     * @brief Manually trigger a price update
+     * @brief Get the per-coin refresh policy
      */
-    void UpdatePrices();
+    const RefreshPolicy& GetRefreshPolicy() const { return config.refresh; }
+
+    /**
+     * @brief Get the spread of per-coin refresh intervals
+     * @return Copy as of the last fetch
+     */
+    RefreshStats GetRefreshStats();
+
+    /**
+     * @brief Get timings of the most recent fetch
+     * @return Copy of the last FetchStats
+     */
+    FetchStats GetLastFetchStats();
+
+    /**
+     * @brief Whether the ticker stream is connected (cheap, for UI indicators)
+     */
+    bool IsStreaming() const { return streaming.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Get ticker stream counters
+     * @return Copy of the counters as of the last applied batch
+     */
+    StreamStats GetStreamStats();
+
+    /**
+     * @brief Get counters of every price provider
+     * @return One entry per provider, in configuration order
+     */
+    std::vector<ProviderStats> GetProviderStats();
+
+    /**
+     * @brief Get connection reuse counters of the HTTP transport
+     * @return Requests, new connections and keep-alive reuses so far
+     */
+    TransportStats GetTransportStats() const { return transport->GetStats(); }
 
     /**
      * @brief Check if connection to API is healthy
@@ -80,11 +369,6 @@ public:
      */
     void LoadWatchlist();
 
-    /**
-     * @brief Lock for accessing coin data from UI thread
-     */
-    std::mutex& GetMutex() { return data_mutex; }
-
 private:
     /**
      * @brief Initialize the list of popular cryptocurrencies
@@ -92,21 +376,173 @@ private:
     void InitializeCoins();
 
     /**
-     * @brief Background thread function for periodic updates
+     * @brief Scheduler loop: waits for the next deadline, a refresh request or stop
      */
     void UpdateThreadFunc();
 
     /**
      * @brief Fetch prices from CoinGecko API
-     * @return true if successful
+     *
+     * Requests the coins whose refresh is due, most overdue first.
+     * @param all_coins Refresh every coin regardless of its deadline
+     * @return true if successful (or nothing was due)
+     */
+    bool FetchPricesFromAPI(bool all_coins);
+
+    /**
+     * @brief Alert loop: evaluates the updates of its tick queue after every publication
+     */
+    void AlertThreadFunc();
+
+    /**
+     * @brief Stream loop: keeps the ticker subscription open and applies its batches
+     */
+    void StreamThreadFunc();
+
+    /**
+     * @brief Apply the pending stream updates, then reset 'quotes' and 'dirty'
+     * @param catalog Coin list the slots refer to
+     * @return false if the coin list changed meanwhile (the batch is dropped)
+     */
+    bool ApplyStreamBatch(const std::shared_ptr<const CoinCatalog>& catalog, std::vector<StagedQuote>& quotes,
+        std::vector<uint32_t>& dirty, int64_t newest_event_ms, StreamStats& counters);
+
+    /**
+     * @brief Record a stream connect/disconnect and wake the scheduler
+     */
+    void SetStreamConnected(bool connected, StreamStats& counters);
+
+    /**
+     * @brief Result of CommitQuotes
+     */
+    struct CommitOutcome {
+        size_t coins_updated = 0;
+        size_t coins_changed = 0;
+        double lock_hold_us = 0.0;
+    };
+
+    /**
+     * @brief Record, persist and publish parsed quotes
+     *
+     * Only prices and changes that moved beyond the configured epsilons are
+     * written: they are appended to the history rings and the tick log,
+     * applied to 'store' and listed in the published snapshot's changes.
+     * The same coins are pushed into every tick queue. Every price still
+     * feeds the refresh scheduler. Shared by polling and
+     * streaming. Caller holds fetch_mutex.
+     *
+     * Only the queue pushes are lock-free. The tick log's batch handoff
+     * takes its own short lock, because the log must not conflate, and
+     * the merge into 'store' takes data_mutex.
+     * @param quotes Parsed quotes by slot of the current catalog
+     * @param slots Slots of 'quotes' to apply
+     * @param now Time stamped on the prices
+     */
+    CommitOutcome CommitQuotes(const std::vector<StagedQuote>& quotes, const std::vector<uint32_t>& slots,
+        std::chrono::system_clock::time_point now);
+
+    /**
+     * @brief Build 'providers' from config (api_endpoint alone when none are configured)
+     */
+    void CreateProviders();
+
+    /**
+     * @brief Fetch from all providers at once and wait for a quorum
+     *
+     * Providers still running once the quorum answered, or past their own
+     * timeout, are cancelled and left out. Caller holds fetch_mutex.
+     * @param results Filled with one result per provider
+     * @param merged Set to whether each provider's staging holds usable quotes
+     */
+    void FetchProviders(std::vector<ProviderResult>& results, std::vector<char>& merged);
+
+    /**
+     * @brief Providers that must answer before a fetch stops waiting
+     */
+    size_t ProviderQuorum() const;
+
+    /**
+     * @brief Replace the store with one for a new catalog; resets staging and the refresh schedule
+     *
+     * Closes the tick queues of the old catalog.
+     */
+    void ResetCoinStore(std::shared_ptr<const CoinCatalog> catalog);
+
+    /**
+     * @brief Start of the window the history rings can hold at the current interval
+     */
+    int64_t HistoryWindowStart(const PriceHistory& rings, std::chrono::milliseconds interval) const;
+
+    /**
+     * @brief Copy the current data into a new CoinSnapshot and publish it
+     *
+     * Caller holds data_mutex.
+     * @param moved Coins whose price or change moved since the current snapshot
+     */
+    void PublishSnapshot(std::vector<uint32_t> moved = {});
+
+    /**
+     * @brief Publish a snapshot that was prepared outside the lock
+     *
+     * Caller holds data_mutex; assigns the next version number.
+     */
+    void PublishSnapshot(std::shared_ptr<CoinSnapshot> next);
+
+    /**
+     * @brief Invoke the change callback for a status-only change
+     */
+    void NotifyStatusChanged();
+
+    /**
+     * @brief Set the watchlist flag of a coin (caller holds data_mutex)
+     * @return false if the ID is unknown
      */
-    bool FetchPricesFromAPI();
+    bool SetWatchlistFlag(std::string_view coinId, bool in_watchlist);
 
-    std::vector<Coin> coins;                    // List of all available coins
+    PriceManagerConfig config;                  // Endpoint and behaviour options
+    std::shared_ptr<HttpTransport> transport;   // Long-lived HTTP client, keeps connections alive across polls
+    std::mutex fetch_mutex;                     // Serializes fetches (guards the providers and staging)
+    std::vector<std::unique_ptr<PriceProvider>> providers; // Price sources; each stages its own quotes
+    std::vector<ProviderStats> provider_stats;  // Per-provider counters (guarded by data_mutex)
+    RefreshScheduler refresh;                   // Per-coin refresh deadlines (guarded by fetch_mutex)
+    std::vector<uint32_t> due_slots;            // Scratch: coins due in this fetch, most overdue first
+    std::vector<PriceBatch> fetch_batches;      // Request plan of the current fetch (guarded by fetch_mutex)
+    std::atomic<std::chrono::steady_clock::time_point> next_refresh_due{
+        std::chrono::steady_clock::time_point::min() }; // Earliest coin deadline the budgets allow
+    RefreshStats refresh_stats;                 // Interval spread as of the last fetch (guarded by data_mutex)
+    std::vector<StagedQuote> staging;           // Consensus quotes per slot, applied under data_mutex
+    std::vector<uint32_t> commit_slots;         // Scratch: staging slots a fetch applies (guarded by fetch_mutex)
+    std::vector<uint8_t> moved_fields;          // Scratch: StagedQuote fields that moved, per slot (guarded by fetch_mutex)
+    std::vector<uint64_t> tick_keys;            // TickLog::CoinKey per slot (empty without a tick log)
+    CoinStore store;                            // Live prices/flags; catalog replaced under both locks
+    FetchStats last_fetch_stats;                // Timings of the last fetch (guarded by data_mutex)
     std::mutex data_mutex;                      // Protects shared data access
-    std::atomic<bool> should_stop;              // Signal to stop background thread
+    std::atomic<bool> should_stop;              // Signal to stop background thread (set under schedule_mutex)
     std::atomic<bool> is_connected;             // Connection status
     std::thread update_thread;                  // Background update thread
+    std::thread stream_thread;                  // Ticker stream thread (stream_prices only)
+    std::atomic<bool> streaming{ false };       // Stream connected; only due coins are polled (set under schedule_mutex)
+    StreamStats stream_stats;                   // Stream counters (guarded by data_mutex)
+    std::mutex schedule_mutex;                  // Guards the scheduler state below
+    std::condition_variable schedule_cv;        // Wakes the update thread (refresh request, interval change, stop)
+    bool refresh_requested = false;             // On-demand refresh queued (refresh_promise is live)
+    std::promise<bool> refresh_promise;         // Completes the queued refresh
+    std::shared_future<bool> refresh_future;    // Handed to callers of the queued refresh
+    std::shared_future<bool> running_future;    // Fetch currently running (invalid when idle)
+    std::atomic<bool> update_in_progress{ false }; // A fetch is queued or running
+    std::chrono::milliseconds update_interval;  // Current periodic interval
+    std::chrono::steady_clock::time_point last_update_start; // Start of the last scheduled fetch
     std::string last_update_time;               // Timestamp of last update
-    static constexpr int UPDATE_INTERVAL_SEC = 30; // Update every 30 seconds
+    std::atomic<std::shared_ptr<const CoinSnapshot>> snapshot; // Latest published data for readers
+    std::atomic<std::shared_ptr<PriceHistory>> history; // Tick rings for the current catalog (written under fetch_mutex)
+    std::unique_ptr<TickLog> tick_log;          // On-disk history (null unless persist_ticks)
+    std::vector<std::shared_ptr<TickQueue>> tick_queues; // Subscribers fed by CommitQuotes (guarded by fetch_mutex)
+    std::mutex alert_mutex;                     // Guards 'alerts' and starting alert_thread
+    AlertEngine alerts;                         // Alert rules, states and log
+    std::thread alert_thread;                   // Alert evaluator (started by the first AddAlert)
+    std::atomic<uint64_t> alert_version{ 0 };   // Bumped when alerts or their states change
+    std::atomic<uint64_t> data_version;         // Version of 'snapshot'
+    std::mutex notify_mutex;                    // Guards data_changed_cv waits and the callback
+    std::condition_variable data_changed_cv;    // Signalled on every publication
+    std::function<void(uint64_t)> data_changed_callback; // Optional change hook
 };
\ No newline at end of file
@@ -0,0 +1,210 @@
+#include "PriceProvider.h"
+#include <algorithm>
+#include <thread>
+
+namespace {
+
+double MicrosecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief One provider's value for the field being merged
+ */
+struct Sample {
+    double value;
+    double weight;
+};
+
+/**
+ * @brief Median (mean of the middle two for an even count) or weighted mean of 'samples'
+ */
+double Combine(Sample* samples, size_t count, ConsensusMethod method) {
+    if (method == ConsensusMethod::WeightedMean) {
+        double sum = 0.0, weights = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            sum += samples[i].value * samples[i].weight;
+            weights += samples[i].weight;
+        }
+        if (weights > 0.0) return sum / weights;
+    }
+
+    // A handful of providers: insertion sort beats anything fancier
+    for (size_t i = 1; i < count; ++i) {
+        Sample s = samples[i];
+        size_t j = i;
+        for (; j > 0 && samples[j - 1].value > s.value; --j) {
+            samples[j] = samples[j - 1];
+        }
+        samples[j] = s;
+    }
+    if (count % 2 == 1) return samples[count / 2].value;
+    return (samples[count / 2 - 1].value + samples[count / 2].value) / 2.0;
+}
+
+} // namespace
+
+PriceProvider::PriceProvider(PriceProviderConfig config, std::shared_ptr<HttpTransport> transport)
+    : config(std::move(config)), transport(std::move(transport)), budget(this->config.budget) {
+}
+
+PriceProvider::BatchOutcome PriceProvider::FetchBatch(const PriceBatch& batch, const CoinIndex& index,
+    ResponseBuffer& buffer) {
+    BatchOutcome outcome;
+    outcome.sent = true;
+    PriceParseResult parsed;
+    RateLimitSignal signal;
+
+    // Stream the response through the SAX parser as it downloads
+    bool received = transport->GetStreaming(config.endpoint, batch.path, buffer,
+        [&](BodyStream& stream) {
+            signal = RateLimitSignal::Read(stream, std::chrono::system_clock::now());
+            if (signal.status / 100 != 2) return;   // 429s and errors carry no price JSON
+
+            auto parse_start = std::chrono::steady_clock::now();
+            parsed = PriceResponseParser::Parse(stream, index, staging, &batch.slots);
+            outcome.parse_us = MicrosecondsSince(parse_start) - parsed.stream_wait_us;
+        });
+
+    // A request cut off by Cancel() says nothing about the provider's limits
+    if (!cancelled.load()) {
+        ResponseUse use = ResponseUse::Unusable;
+        if (received && signal.status / 100 == 2 && parsed.ok) {
+            use = parsed.quotes > 0 ? ResponseUse::Quotes : ResponseUse::Empty;
+        }
+        budget.Record(signal, use, std::chrono::steady_clock::now());
+    }
+
+    if (!received || signal.status == 0) {
+        outcome.error = "HTTP request failed";
+    }
+    else if (signal.status / 100 != 2) {
+        outcome.error = "HTTP " + std::to_string(signal.status);
+    }
+    else if (buffer.Size() == 0) {
+        outcome.error = "Empty response";
+    }
+    else if (!parsed.ok) {
+        outcome.error = parsed.error;
+    }
+    else {
+        outcome.ok = true;
+    }
+    return outcome;
+}
+
+ProviderResult PriceProvider::Fetch(const std::vector<PriceBatch>& batches, const CoinIndex& index,
+    size_t max_concurrency, const std::atomic<bool>& stop) {
+    ProviderResult result;
+    result.batch_ok.assign(batches.size(), 0);
+
+    // Quotes of coins outside this fetch must not be merged again
+    for (auto& quote : staging) quote.fields = 0;
+    if (batches.empty()) {
+        return result;
+    }
+
+    // The most overdue batches get whatever the budget allows right now
+    size_t granted = budget.Acquire(batches.size(), std::chrono::steady_clock::now());
+    size_t workers = std::max<size_t>(1, std::min(max_concurrency, granted));
+    while (response_buffers.size() < workers) {
+        response_buffers.emplace_back();
+    }
+
+    // Workers pull batch numbers until none are left; each batch writes
+    // only its own staging slots, so no locking is needed here
+    std::vector<BatchOutcome> outcomes(batches.size());
+    std::atomic<size_t> next{ 0 };
+    std::atomic<size_t> unused{ 0 };
+    auto run_worker = [&](size_t worker) {
+        for (size_t b = next.fetch_add(1); b < granted; b = next.fetch_add(1)) {
+            if (stop.load() || cancelled.load()) {
+                outcomes[b].error = "Cancelled";    // Shutting down or cut off: skip the remaining batches
+                unused.fetch_add(1);
+                continue;
+            }
+            if (!budget.Open(std::chrono::steady_clock::now())) {
+                outcomes[b].error = "Rate limited"; // A 429 earlier in this fetch started a backoff
+                unused.fetch_add(1);
+                continue;
+            }
+            outcomes[b] = FetchBatch(batches[b], index, response_buffers[worker]);
+        }
+    };
+
+    auto request_start = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (size_t w = 1; w < workers; ++w) {
+        pool.emplace_back(run_worker, w);
+    }
+    run_worker(0);
+    for (auto& t : pool) {
+        t.join();
+    }
+    result.request_us = MicrosecondsSince(request_start);
+    budget.Release(unused.load());
+
+    for (size_t b = 0; b < batches.size(); ++b) {
+        result.parse_us += outcomes[b].parse_us;
+        result.sent += outcomes[b].sent;
+        if (outcomes[b].ok) {
+            result.batch_ok[b] = 1;
+            continue;
+        }
+
+        // A failed batch may have parsed part of its coins; drop them
+        if (!outcomes[b].sent) continue;
+        ++result.failed_batches;
+        if (result.error.empty()) {
+            result.error = outcomes[b].error;
+        }
+        for (uint32_t slot : batches[b].slots) {
+            staging[slot].fields = 0;
+        }
+    }
+    result.skipped = batches.size() - result.sent;
+    if (result.error.empty() && result.skipped > 0) {
+        result.error = "Rate limited";
+    }
+    result.ok = result.failed_batches == 0 && result.skipped == 0;
+    return result;
+}
+
+void MergeQuotes(const std::vector<const std::vector<StagedQuote>*>& sources, const std::vector<double>& weights,
+    ConsensusMethod method, std::vector<StagedQuote>& out, std::vector<uint32_t>& slots) {
+    slots.clear();
+    if (sources.empty()) {
+        for (auto& quote : out) quote.fields = 0;
+        return;
+    }
+
+    std::vector<Sample> prices(sources.size());
+    std::vector<Sample> changes(sources.size());
+    for (size_t slot = 0; slot < out.size(); ++slot) {
+        size_t price_count = 0, change_count = 0;
+        for (size_t s = 0; s < sources.size(); ++s) {
+            const StagedQuote& quote = (*sources[s])[slot];
+            if (quote.fields & StagedQuote::HAS_PRICE) {
+                prices[price_count++] = { quote.price, weights[s] };
+            }
+            if (quote.fields & StagedQuote::HAS_CHANGE) {
+                changes[change_count++] = { quote.change_24h, weights[s] };
+            }
+        }
+
+        StagedQuote& merged = out[slot];
+        merged.fields = 0;
+        if (price_count > 0) {
+            merged.price = Combine(prices.data(), price_count, method);
+            merged.fields |= StagedQuote::HAS_PRICE;
+        }
+        if (change_count > 0) {
+            merged.change_24h = Combine(changes.data(), change_count, method);
+            merged.fields |= StagedQuote::HAS_CHANGE;
+        }
+        if (merged.fields != 0) {
+            slots.push_back(static_cast<uint32_t>(slot));
+        }
+    }
+}
@@ -0,0 +1,145 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "HttpTransport.h"
+#include "FetchPlanner.h"
+#include "PriceResponseParser.h"
+#include "RequestBudget.h"
+
+/**
+ * @brief How quotes of several providers are combined per coin
+ */
+enum class ConsensusMethod {
+    Median,         // Median of the answering providers (an outlier cannot move it)
+    WeightedMean    // Mean weighted by PriceProviderConfig::weight
+};
+
+/**
+ * @brief One CoinGecko-compatible price source (API, mirror or proxy)
+ */
+struct PriceProviderConfig {
+    std::string name;                           // Label for logs and stats
+    HttpEndpoint endpoint;                      // Server answering /api/v3/simple/price
+    double weight = 1.0;                        // Weight in the WeightedMean consensus
+    std::chrono::milliseconds timeout{ 0 };     // Longest wait for the whole fetch (0 = no limit)
+    RequestBudgetConfig budget;                 // Rate limit towards this provider
+};
+
+/**
+ * @brief Outcome of one provider's fetch
+ */
+struct ProviderResult {
+    bool ok = false;                // Every batch was sent and succeeded
+    size_t sent = 0;                // Batches requested
+    size_t skipped = 0;             // Batches the request budget held back
+    size_t failed_batches = 0;      // Sent batches that failed or returned bad JSON
+    std::vector<char> batch_ok;     // Per batch: fresh quotes are in staging
+    double parse_us = 0.0;          // JSON parse time summed over batches (excluding network waits)
+    double request_us = 0.0;        // Wall time of the whole fetch
+    bool cut_off = false;           // Abandoned at its timeout or once the quorum answered
+    std::string error;              // First batch error
+};
+
+/**
+ * @brief Per-provider counters kept by PriceManager
+ */
+struct ProviderStats {
+    std::string name;
+    uint64_t rounds = 0;            // Fetches the provider took part in
+    uint64_t merged = 0;            // Rounds its quotes went into the consensus
+    uint64_t failed = 0;            // Rounds with failed batches
+    uint64_t cut_off = 0;           // Rounds abandoned at its timeout or once the quorum answered
+    double last_request_ms = 0.0;   // Wall time of its last finished fetch
+    RequestBudgetStats budget;      // Sent vs. rejected requests, 429s and backoffs
+};
+
+/**
+ * @brief Fetches one provider's quotes into its own staging vector
+ *
+ * Each provider owns its receive buffers and staging, so several providers
+ * can be fetched concurrently and merged afterwards. Cancel() aborts the
+ * provider's transport, which is why providers in a multi-provider setup
+ * get a transport of their own. Requests are paced by the provider's
+ * RequestBudget, which also learns from 429s and rate-limit headers.
+ */
+class PriceProvider {
+public:
+    PriceProvider(PriceProviderConfig config, std::shared_ptr<HttpTransport> transport);
+
+    /**
+     * @brief Fetch the batches the budget allows (max_concurrency at a time) into Staging()
+     *
+     * Batches are taken in order (most urgent first, see FetchPlanner::Plan)
+     * until the budget runs out. Only slots of batches that succeeded
+     * carry fields afterwards.
+     * @param stop Checked between batches; set on shutdown
+     */
+    ProviderResult Fetch(const std::vector<PriceBatch>& batches, const CoinIndex& index,
+        size_t max_concurrency, const std::atomic<bool>& stop);
+
+    /**
+     * @brief Abort the fetch in flight; its remaining batches fail until ClearCancel()
+     *
+     * Requests still resolving or connecting run to completion first.
+     */
+    void Cancel() {
+        cancelled.store(true);
+        transport->CancelAll();
+    }
+
+    /**
+     * @brief Allow fetching again after Cancel() (call before starting a Fetch)
+     */
+    void ClearCancel() { cancelled.store(false); }
+
+    /**
+     * @brief Size the staging vector for a new coin list
+     */
+    void ResetStaging(size_t slots) { staging.assign(slots, StagedQuote()); }
+
+    const std::vector<StagedQuote>& Staging() const { return staging; }
+    const PriceProviderConfig& Config() const { return config; }
+    const RequestBudget& Budget() const { return budget; }
+    const HttpTransport& Transport() const { return *transport; }
+
+private:
+    /**
+     * @brief Outcome of one batch request
+     */
+    struct BatchOutcome {
+        bool sent = false;
+        bool ok = false;
+        double parse_us = 0.0;
+        std::string error;
+    };
+
+    /**
+     * @brief Fetch and parse one batch into its staging slots
+     * @param buffer Receive buffer owned by the calling worker
+     */
+    BatchOutcome FetchBatch(const PriceBatch& batch, const CoinIndex& index, ResponseBuffer& buffer);
+
+    PriceProviderConfig config;
+    std::shared_ptr<HttpTransport> transport;   // May be shared with PriceManager (single provider)
+    std::vector<ResponseBuffer> response_buffers; // One per fetch worker, reused across polls
+    std::vector<StagedQuote> staging;           // Parsed quotes per slot
+    std::atomic<bool> cancelled{ false };       // Set by Cancel(); skips the remaining batches
+    RequestBudget budget;                       // Token bucket and backoff state
+};
+
+/**
+ * @brief Combine the quotes of several providers into one quote per slot
+ *
+ * Price and 24h change are merged independently over the sources that
+ * have them. A single source is copied as is.
+ * @param sources Staging vectors of the providers that answered
+ * @param weights Weight per source (WeightedMean only)
+ * @param out Consensus quotes, one entry per slot; slots nobody quoted get no fields
+ * @param slots Cleared, then the slots of 'out' that have fields
+ */
+void MergeQuotes(const std::vector<const std::vector<StagedQuote>*>& sources, const std::vector<double>& weights,
+    ConsensusMethod method, std::vector<StagedQuote>& out, std::vector<uint32_t>& slots);
@@ -0,0 +1,203 @@
+#include "PriceResponseParser.h"
+#include <json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+
+using json = nlohmann::json;
+
+namespace {
+
+/**
+ * @brief SAX handler for {"<id>": {"usd": x, "usd_24h_change": y}, ...}
+ */
+class PriceSaxHandler : public json::json_sax_t {
+public:
+    PriceSaxHandler(const CoinIndex& index, std::vector<StagedQuote>& staging,
+        const std::vector<uint32_t>* slots)
+        : index(index), staging(staging), slots(slots) {
+    }
+
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+    bool number_integer(number_integer_t val) override { return Number(static_cast<double>(val)); }
+    bool number_unsigned(number_unsigned_t val) override { return Number(static_cast<double>(val)); }
+    bool number_float(number_float_t val, const string_t&) override { return Number(val); }
+    bool string(string_t&) override { return true; }
+    bool binary(binary_t&) override { return true; }
+
+    bool start_object(std::size_t) override {
+        ++depth;
+        return true;
+    }
+
+    bool end_object() override {
+        if (depth == 2) {
+            current_slot = NO_SLOT;
+        }
+        --depth;
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        ++depth;
+        return true;
+    }
+
+    bool end_array() override {
+        --depth;
+        return true;
+    }
+
+    bool key(string_t& val) override {
+        if (depth == 1) {
+            // Single hash lookup per coin; ids outside this batch are ignored
+            current_slot = index.FindById(val);
+            if (current_slot != NO_SLOT && !InBatch(current_slot)) {
+                current_slot = NO_SLOT;
+            }
+        }
+        else if (depth == 2) {
+            if (val == "usd") current_field = Field::Price;
+            else if (val == "usd_24h_change") current_field = Field::Change;
+            else current_field = Field::Other;
+        }
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+        error = ex.what();
+        return false;
+    }
+
+    size_t quotes = 0;
+    std::string error;
+
+private:
+    enum class Field { Other, Price, Change };
+    static constexpr size_t NO_SLOT = CoinIndex::NOT_FOUND;
+
+    bool InBatch(size_t slot) const {
+        if (slots == nullptr) return slot < staging.size();
+        return std::binary_search(slots->begin(), slots->end(), static_cast<uint32_t>(slot));
+    }
+
+    bool Number(double val) {
+        if (depth != 2 || current_slot == NO_SLOT) return true;
+
+        StagedQuote& quote = staging[current_slot];
+        if (current_field == Field::Price) {
+            if (!(quote.fields & StagedQuote::HAS_PRICE)) ++quotes;
+            quote.price = val;
+            quote.fields |= StagedQuote::HAS_PRICE;
+        }
+        else if (current_field == Field::Change) {
+            quote.change_24h = val;
+            quote.fields |= StagedQuote::HAS_CHANGE;
+        }
+        return true;
+    }
+
+    const CoinIndex& index;
+    std::vector<StagedQuote>& staging;
+    const std::vector<uint32_t>* slots;
+    int depth = 0;
+    size_t current_slot = NO_SLOT;
+    Field current_field = Field::Other;
+};
+
+/**
+ * @brief Shared read position over a BodyStream
+ *
+ * Pulls the next chunk only when the parser has consumed the current one,
+ * so parsing proceeds while the rest of the response is still in flight.
+ */
+struct StreamCursor {
+    BodyStream& stream;
+    const char* pos = nullptr;
+    const char* end = nullptr;
+    double wait_us = 0.0;
+
+    bool Refill() {
+        auto start = std::chrono::steady_clock::now();
+        std::string_view chunk = stream.Next();
+        wait_us += std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - start).count();
+        pos = chunk.data();
+        end = pos + chunk.size();
+        return !chunk.empty();
+    }
+};
+
+/**
+ * @brief Input iterator adapter feeding a StreamCursor to json::sax_parse
+ */
+class StreamIterator {
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = char;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const char*;
+    using reference = const char&;
+
+    StreamIterator() = default;
+    explicit StreamIterator(StreamCursor* cursor) : cursor(cursor) {}
+
+    reference operator*() const { return *cursor->pos; }
+
+    StreamIterator& operator++() {
+        ++cursor->pos;
+        return *this;
+    }
+
+    // Only comparisons against the end iterator are meaningful
+    bool operator==(const StreamIterator& other) const { return AtEnd() == other.AtEnd(); }
+    bool operator!=(const StreamIterator& other) const { return !(*this == other); }
+
+private:
+    bool AtEnd() const {
+        return cursor == nullptr || (cursor->pos == cursor->end && !cursor->Refill());
+    }
+
+    StreamCursor* cursor = nullptr;
+};
+
+void ResetStaging(std::vector<StagedQuote>& staging, const std::vector<uint32_t>* slots) {
+    if (slots == nullptr) {
+        for (StagedQuote& quote : staging) quote.fields = 0;
+        return;
+    }
+    for (uint32_t slot : *slots) {
+        if (slot < staging.size()) staging[slot].fields = 0;
+    }
+}
+
+} // namespace
+
+PriceParseResult PriceResponseParser::Parse(BodyStream& stream, const CoinIndex& index,
+    std::vector<StagedQuote>& staging, const std::vector<uint32_t>* slots) {
+    ResetStaging(staging, slots);
+
+    PriceSaxHandler handler(index, staging, slots);
+    StreamCursor cursor{ stream };
+
+    PriceParseResult result;
+    result.ok = json::sax_parse(StreamIterator(&cursor), StreamIterator(), &handler);
+    result.quotes = handler.quotes;
+    result.stream_wait_us = cursor.wait_us;
+    result.error = std::move(handler.error);
+    return result;
+}
+
+PriceParseResult PriceResponseParser::Parse(std::string_view body, const CoinIndex& index,
+    std::vector<StagedQuote>& staging, const std::vector<uint32_t>* slots) {
+    ResetStaging(staging, slots);
+
+    PriceSaxHandler handler(index, staging, slots);
+
+    PriceParseResult result;
+    result.ok = json::sax_parse(body.begin(), body.end(), &handler);
+    result.quotes = handler.quotes;
+    result.error = std::move(handler.error);
+    return result;
+}
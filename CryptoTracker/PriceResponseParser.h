@@ -0,0 +1,59 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include "HttpTransport.h"
+#include "CoinIndex.h"
+
+/**
+ * @brief Price fields parsed for one coin, written by slot index
+ */
+struct StagedQuote {
+    static constexpr uint8_t HAS_PRICE = 1;     // 'price' was present
+    static constexpr uint8_t HAS_CHANGE = 2;    // 'change_24h' was present
+
+    double price = 0.0;
+    double change_24h = 0.0;
+    uint8_t fields = 0;                         // HAS_PRICE | HAS_CHANGE
+};
+
+/**
+ * @brief Outcome of parsing one /simple/price response
+ */
+struct PriceParseResult {
+    bool ok = false;                // Whole document parsed
+    size_t quotes = 0;              // Known coins that received a price
+    double stream_wait_us = 0.0;    // Time spent waiting for network chunks
+    std::string error;              // Parser message when !ok
+};
+
+/**
+ * @brief Streaming parser for CoinGecko /simple/price responses
+ *
+ * Uses the nlohmann::json SAX interface, so no DOM is built: each top-level
+ * key is resolved to its slot with one hash lookup and "usd" /
+ * "usd_24h_change" are written straight into 'staging[slot]'. Unknown ids
+ * and any other fields are skipped.
+ *
+ * Each call only touches the staging slots of its batch, so concurrent
+ * batch requests can share one staging vector.
+ */
+class PriceResponseParser {
+public:
+    /**
+     * @brief Parse a body while it is being downloaded
+     * @param stream Chunks from HttpTransport::GetStreaming
+     * @param index ID -> slot lookup
+     * @param staging Output, must have one entry per slot
+     * @param slots Sorted slots this response may write (nullptr = any)
+     */
+    static PriceParseResult Parse(BodyStream& stream, const CoinIndex& index,
+        std::vector<StagedQuote>& staging, const std::vector<uint32_t>* slots = nullptr);
+
+    /**
+     * @brief Parse a body that is already in memory
+     */
+    static PriceParseResult Parse(std::string_view body, const CoinIndex& index,
+        std::vector<StagedQuote>& staging, const std::vector<uint32_t>* slots = nullptr);
+};
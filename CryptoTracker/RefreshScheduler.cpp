@@ -0,0 +1,167 @@
+#include "RefreshScheduler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Orders the heap so the earliest deadline is on top
+struct LaterDue {
+    template <typename Entry>
+    bool operator()(const Entry& a, const Entry& b) const { return a.due > b.due; }
+};
+
+} // namespace
+
+RefreshScheduler::RefreshScheduler(size_t count, const RefreshPolicy& policy, Clock::time_point now)
+    : policy(policy), coins(count) {
+    heap.reserve(count * 2);
+    for (size_t i = 0; i < count; ++i) {
+        coins[i].due = now;
+        coins[i].refreshed = Clock::time_point::min();
+        coins[i].queued = true;
+        heap.push_back({ now, static_cast<uint32_t>(i) });
+    }
+    // All equal: already a heap
+}
+
+RefreshScheduler::Clock::duration RefreshScheduler::ComputeInterval(const CoinState& coin) const {
+    if (!policy.adaptive) {
+        return base_interval;
+    }
+
+    double interval_ms = static_cast<double>(base_interval.count());
+
+    if (coin.samples > 0) {
+        // Expected |move| after t ms is sqrt(v * t); refresh when it reaches target_move
+        interval_ms = coin.variance_rate > 0.0
+            ? policy.target_move * policy.target_move / coin.variance_rate
+            : static_cast<double>(policy.max_interval.count());
+    }
+    if (coin.watched) {
+        interval_ms *= policy.watchlist_factor;
+    }
+    interval_ms = std::clamp(interval_ms, static_cast<double>(policy.min_interval.count()),
+        static_cast<double>(policy.max_interval.count()));
+    return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(interval_ms));
+}
+
+void RefreshScheduler::Push(uint32_t slot) {
+    coins[slot].queued = true;
+    heap.push_back({ coins[slot].due, slot });
+    std::push_heap(heap.begin(), heap.end(), LaterDue());
+    Compact();
+}
+
+void RefreshScheduler::Compact() {
+    if (heap.size() <= coins.size() * 2 + 64) return;
+
+    heap.erase(std::remove_if(heap.begin(), heap.end(), [&](const Entry& entry) {
+        const CoinState& coin = coins[entry.slot];
+        return !coin.queued || coin.due != entry.due;
+    }), heap.end());
+    std::make_heap(heap.begin(), heap.end(), LaterDue());
+}
+
+void RefreshScheduler::SetWatchlist(const std::vector<size_t>& watchlist) {
+    std::vector<char> watched(coins.size(), 0);
+    for (size_t slot : watchlist) {
+        if (slot < coins.size()) watched[slot] = 1;
+    }
+
+    for (size_t i = 0; i < coins.size(); ++i) {
+        CoinState& coin = coins[i];
+        if (coin.watched == (watched[i] != 0)) continue;
+        coin.watched = watched[i] != 0;
+
+        // Popped coins pick the change up in Schedule()
+        if (coin.queued && coin.refreshed != Clock::time_point::min()) {
+            coin.due = coin.refreshed + ComputeInterval(coin);
+            Push(static_cast<uint32_t>(i));
+        }
+    }
+}
+
+void RefreshScheduler::PopDue(Clock::time_point now, bool all, std::vector<uint32_t>& due) {
+    due.clear();
+    while (!heap.empty() && (all || heap.front().due <= now)) {
+        std::pop_heap(heap.begin(), heap.end(), LaterDue());
+        Entry entry = heap.back();
+        heap.pop_back();
+
+        CoinState& coin = coins[entry.slot];
+        if (!coin.queued || coin.due != entry.due) continue;     // Stale entry
+        coin.queued = false;
+        due.push_back(entry.slot);
+    }
+}
+
+void RefreshScheduler::Schedule(uint32_t slot, Clock::time_point now) {
+    CoinState& coin = coins[slot];
+    coin.due = now + ComputeInterval(coin);
+    Push(slot);
+}
+
+void RefreshScheduler::Retry(uint32_t slot) {
+    Push(slot);
+}
+
+void RefreshScheduler::Observe(uint32_t slot, double price, Clock::time_point now) {
+    CoinState& coin = coins[slot];
+    if (!(price > 0.0)) return;
+
+    if (coin.last_price > 0.0 && now > coin.refreshed && coin.refreshed != Clock::time_point::min()) {
+        double elapsed_ms = std::chrono::duration<double, std::milli>(now - coin.refreshed).count();
+        double log_return = std::log(price / coin.last_price);
+        double rate = log_return * log_return / elapsed_ms;
+        coin.variance_rate = coin.samples == 0 ? rate
+            : coin.variance_rate + policy.smoothing * (rate - coin.variance_rate);
+        ++coin.samples;
+    }
+    coin.last_price = price;
+    coin.refreshed = now;
+}
+
+RefreshScheduler::Clock::time_point RefreshScheduler::NextDue() {
+    // Stale entries on top would report a deadline nobody has
+    while (!heap.empty()) {
+        const Entry& top = heap.front();
+        const CoinState& coin = coins[top.slot];
+        if (coin.queued && coin.due == top.due) return top.due;
+        std::pop_heap(heap.begin(), heap.end(), LaterDue());
+        heap.pop_back();
+    }
+    return Clock::time_point::max();
+}
+
+std::chrono::milliseconds RefreshScheduler::Interval(uint32_t slot) const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(ComputeInterval(coins[slot]));
+}
+
+RefreshStats RefreshScheduler::Stats(Clock::time_point now) const {
+    RefreshStats stats;
+    stats.coins = coins.size();
+    if (coins.empty()) return stats;
+
+    std::vector<double> intervals;
+    intervals.reserve(coins.size());
+    for (const CoinState& coin : coins) {
+        double interval_ms = std::chrono::duration<double, std::milli>(ComputeInterval(coin)).count();
+        intervals.push_back(interval_ms);
+        if (policy.adaptive) {
+            stats.volatile_coins += interval_ms <= static_cast<double>(policy.min_interval.count());
+            stats.calm_coins += interval_ms >= static_cast<double>(policy.max_interval.count());
+        }
+        if (coin.refreshed != Clock::time_point::min()) {
+            stats.max_age_ms = std::max(stats.max_age_ms,
+                std::chrono::duration<double, std::milli>(now - coin.refreshed).count());
+        }
+    }
+
+    auto middle = intervals.begin() + intervals.size() / 2;
+    std::nth_element(intervals.begin(), middle, intervals.end());
+    stats.median_interval_ms = *middle;
+    auto [low, high] = std::minmax_element(intervals.begin(), intervals.end());
+    stats.min_interval_ms = *low;
+    stats.max_interval_ms = *high;
+    return stats;
+}
@@ -0,0 +1,144 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief How per-coin refresh intervals are chosen
+ */
+struct RefreshPolicy {
+    bool adaptive = true;                       // false: every coin at the update interval
+    std::chrono::milliseconds min_interval{ 10000 };  // Fastest refresh (most volatile coins)
+    std::chrono::milliseconds max_interval{ 300000 }; // Slowest refresh (pegged or idle coins)
+    double target_move = 0.001;                 // Refresh about when a coin is expected to have moved this much
+    double watchlist_factor = 0.5;              // Interval multiplier for watchlist coins
+    double smoothing = 0.2;                     // Weight of the newest return in the volatility average
+};
+
+/**
+ * @brief Spread of the current refresh intervals
+ */
+struct RefreshStats {
+    size_t coins = 0;                           // Coins scheduled
+    size_t volatile_coins = 0;                  // Coins at the minimum interval
+    size_t calm_coins = 0;                      // Coins at the maximum interval
+    double min_interval_ms = 0.0;
+    double median_interval_ms = 0.0;
+    double max_interval_ms = 0.0;
+    double max_age_ms = 0.0;                    // Oldest price among coins refreshed at least once
+};
+
+/**
+ * @brief Per-coin refresh deadlines, ordered in a min-heap over coin slots
+ *
+ * Each coin is due again 'interval' after its last refresh. The interval
+ * comes from the coin's recent volatility: an exponentially weighted
+ * average of squared log returns per millisecond gives the variance rate
+ * v, and a move of 'target_move' is expected after target_move^2 / v.
+ * Watchlist coins get a shorter interval; coins without two prices yet
+ * use the base interval. A stablecoin thus settles at max_interval while
+ * a coin moving several percent an hour is polled at min_interval.
+ *
+ * PopDue() hands out the overdue coins, most overdue first. Each popped
+ * coin must come back through Schedule() (fetched) or Retry() (not
+ * fetched; it keeps its deadline and stays first in line). Rescheduling
+ * leaves the old heap entry behind; stale entries are skipped lazily and
+ * purged once they outnumber the coins. Not thread-safe; PriceManager
+ * guards it with fetch_mutex.
+ */
+class RefreshScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    RefreshScheduler() = default;
+
+    /**
+     * @brief Schedule 'coins' slots, all due at 'now'
+     */
+    RefreshScheduler(size_t coins, const RefreshPolicy& policy, Clock::time_point now);
+
+    /**
+     * @brief Interval for coins without a volatility estimate (and all coins when not adaptive)
+     */
+    void SetBaseInterval(std::chrono::milliseconds interval) { base_interval = interval; }
+
+    /**
+     * @brief Update watchlist membership; changed coins are rescheduled from their last refresh
+     * @param watchlist Slots of the watchlist members
+     */
+    void SetWatchlist(const std::vector<size_t>& watchlist);
+
+    /**
+     * @brief Take every coin due at 'now' (or every coin with 'all')
+     * @param due Cleared, then the popped slots, most overdue first
+     */
+    void PopDue(Clock::time_point now, bool all, std::vector<uint32_t>& due);
+
+    /**
+     * @brief A coin was refreshed (popped or not): due again one interval from 'now'
+     */
+    void Schedule(uint32_t slot, Clock::time_point now);
+
+    /**
+     * @brief A popped coin was not fetched: back in line with its old deadline
+     */
+    void Retry(uint32_t slot);
+
+    /**
+     * @brief Feed a new price into the coin's volatility estimate
+     *
+     * Does not move the deadline; call Schedule() afterwards so the new
+     * interval applies.
+     */
+    void Observe(uint32_t slot, double price, Clock::time_point now);
+
+    /**
+     * @brief Earliest deadline (time_point::max() when nothing is queued)
+     */
+    Clock::time_point NextDue();
+
+    /**
+     * @brief Current interval of a coin
+     */
+    std::chrono::milliseconds Interval(uint32_t slot) const;
+
+    /**
+     * @brief Interval spread and the oldest price
+     */
+    RefreshStats Stats(Clock::time_point now) const;
+
+private:
+    /**
+     * @brief Scheduling state of one coin
+     */
+    struct CoinState {
+        Clock::time_point due;                  // Next refresh deadline
+        Clock::time_point refreshed;            // Last price (time_point::min() = never)
+        double last_price = 0.0;
+        double variance_rate = 0.0;             // EWMA of squared log returns per ms
+        uint32_t samples = 0;                   // Returns seen
+        bool queued = false;                    // In the heap (false while popped)
+        bool watched = false;                   // Watchlist member
+    };
+
+    /**
+     * @brief Heap entry; stale when 'due' no longer matches the coin's
+     */
+    struct Entry {
+        Clock::time_point due;
+        uint32_t slot;
+    };
+
+    Clock::duration ComputeInterval(const CoinState& coin) const;
+    void Push(uint32_t slot);
+
+    /**
+     * @brief Drop stale entries once they outnumber the coins
+     */
+    void Compact();
+
+    RefreshPolicy policy;
+    std::chrono::milliseconds base_interval{ 30000 };
+    std::vector<CoinState> coins;
+    std::vector<Entry> heap;                    // Min-heap on 'due'
+};
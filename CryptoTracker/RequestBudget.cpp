@@ -0,0 +1,207 @@
+#include "RequestBudget.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+namespace {
+
+/**
+ * @brief Parse a non-negative integer header value (fraction ignored)
+ * @return -1 if the value does not start with a digit
+ */
+int64_t ParseInteger(std::string_view value) {
+    int64_t result = -1;
+    std::from_chars(value.data(), value.data() + value.size(), result);
+    return result < 0 ? -1 : result;
+}
+
+/**
+ * @brief Days since 1970-01-01 of a proleptic Gregorian date
+ */
+int64_t DaysFromCivil(int64_t y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    int64_t era = (y >= 0 ? y : y - 399) / 400;
+    unsigned yoe = static_cast<unsigned>(y - era * 400);
+    unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+/**
+ * @brief Parse an IMF-fixdate ("Sun, 06 Nov 1994 08:49:37 GMT")
+ * @return Unix time in seconds, or -1 if malformed
+ */
+int64_t ParseHttpDate(std::string_view value) {
+    static const char* months = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    size_t comma = value.find(", ");
+    if (comma == std::string_view::npos || value.size() < comma + 22) return -1;
+    std::string_view date = value.substr(comma + 2);
+
+    int day = 0, year = 0, hour = 0, minute = 0, second = 0;
+    auto number = [&](size_t pos, size_t len, int& out) {
+        auto result = std::from_chars(date.data() + pos, date.data() + pos + len, out);
+        return result.ec == std::errc() && result.ptr == date.data() + pos + len;
+    };
+    const char* month = std::strstr(months, std::string(date.substr(3, 3)).c_str());
+    if (!month || (month - months) % 3 != 0) return -1;
+    if (!number(0, 2, day) || !number(7, 4, year) || !number(12, 2, hour) ||
+        !number(15, 2, minute) || !number(18, 2, second)) {
+        return -1;
+    }
+
+    unsigned m = static_cast<unsigned>((month - months) / 3 + 1);
+    return DaysFromCivil(year, m, static_cast<unsigned>(day)) * 86400 + hour * 3600 + minute * 60 + second;
+}
+
+} // namespace
+
+RateLimitSignal RateLimitSignal::Read(const BodyStream& response, std::chrono::system_clock::time_point now) {
+    RateLimitSignal signal;
+    signal.status = response.Status();
+    int64_t now_s = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+
+    std::string_view retry_after = response.Header("Retry-After");
+    if (!retry_after.empty()) {
+        int64_t seconds = ParseInteger(retry_after);
+        if (seconds < 0) {
+            int64_t at = ParseHttpDate(retry_after);
+            if (at >= 0) seconds = std::max<int64_t>(0, at - now_s);
+        }
+        if (seconds >= 0) signal.retry_after_ms = seconds * 1000;
+    }
+
+    std::string_view remaining = response.Header("X-RateLimit-Remaining");
+    if (remaining.empty()) remaining = response.Header("RateLimit-Remaining");
+    signal.remaining = ParseInteger(remaining);
+
+    std::string_view reset = response.Header("X-RateLimit-Reset");
+    if (reset.empty()) reset = response.Header("RateLimit-Reset");
+    int64_t reset_s = ParseInteger(reset);
+    if (reset_s >= 1000000000) {
+        reset_s = std::max<int64_t>(0, reset_s - now_s);    // Unix time rather than a delay
+    }
+    if (reset_s >= 0) signal.reset_ms = reset_s * 1000;
+    return signal;
+}
+
+RequestBudget::RequestBudget(const RequestBudgetConfig& config)
+    : config(config), tokens(config.burst), last_refill(Clock::now()), jitter(std::random_device{}()) {
+}
+
+void RequestBudget::Refill(Clock::time_point now) {
+    if (now <= last_refill) return;
+    double minutes = std::chrono::duration<double>(now - last_refill).count() / 60.0;
+    tokens = std::min(config.burst, tokens + minutes * config.requests_per_minute);
+    last_refill = now;
+}
+
+size_t RequestBudget::Acquire(size_t wanted, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t granted = 0;
+    if (now >= blocked_until) {
+        if (Limited()) {
+            Refill(now);
+            granted = std::min(wanted, static_cast<size_t>(std::max(0.0, tokens)));
+            tokens -= static_cast<double>(granted);
+        }
+        else {
+            granted = wanted;
+        }
+    }
+    stats.rejected += wanted - granted;
+    return granted;
+}
+
+void RequestBudget::Release(size_t unused) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (Limited()) {
+        tokens = std::min(config.burst, tokens + static_cast<double>(unused));
+    }
+    stats.rejected += unused;
+}
+
+bool RequestBudget::Open(Clock::time_point now) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return now >= blocked_until;
+}
+
+void RequestBudget::BackOff(std::chrono::milliseconds hint, Clock::time_point now) {
+    // Responses to requests already in flight do not escalate the backoff again
+    if (now < blocked_until) {
+        if (hint.count() >= 0) blocked_until = std::max(blocked_until, now + hint);
+        return;
+    }
+
+    ++failures;
+    ++stats.backoffs;
+    std::chrono::milliseconds delay;
+    if (hint.count() >= 0) {
+        // Honour the server, plus up to 10% so clients do not return together
+        delay = hint + std::chrono::milliseconds(
+            std::uniform_int_distribution<int64_t>(0, hint.count() / 10)(jitter));
+    }
+    else {
+        // Equal jitter: half the exponential delay fixed, half random
+        int64_t exponential = config.backoff_base.count() << std::min(failures - 1, 20u);
+        exponential = std::min<int64_t>(exponential, config.backoff_max.count());
+        delay = std::chrono::milliseconds(exponential / 2 +
+            std::uniform_int_distribution<int64_t>(0, exponential / 2)(jitter));
+    }
+    blocked_until = now + delay;
+}
+
+void RequestBudget::Record(const RateLimitSignal& signal, ResponseUse use, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(mutex);
+    ++stats.sent;
+
+    if (signal.status == 429) {
+        ++stats.throttled;
+        int64_t hint = signal.retry_after_ms >= 0 ? signal.retry_after_ms : signal.reset_ms;
+        BackOff(std::chrono::milliseconds(hint), now);
+        return;
+    }
+    if (signal.status == 0 || signal.status >= 500) {
+        BackOff(std::chrono::milliseconds(signal.retry_after_ms), now);
+        return;
+    }
+
+    if (signal.remaining >= 0 && Limited()) {
+        Refill(now);
+        tokens = std::min(tokens, static_cast<double>(signal.remaining));
+    }
+    if (signal.remaining == 0 && signal.reset_ms >= 0) {
+        blocked_until = std::max(blocked_until, now + std::chrono::milliseconds(signal.reset_ms));
+    }
+
+    // An error page served with 200, or a 4xx, would otherwise be retried at the
+    // scheduler's retry floor forever; only quotes show the provider works again
+    if (use == ResponseUse::Unusable) {
+        BackOff(std::chrono::milliseconds(signal.retry_after_ms), now);
+    }
+    else if (use == ResponseUse::Quotes) {
+        failures = 0;
+    }
+}
+
+RequestBudget::Clock::time_point RequestBudget::NextAvailable(Clock::time_point now) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    Clock::time_point at = std::max(now, blocked_until);
+    if (!Limited()) return at;
+
+    // Tokens at 'at', then the wait for the missing fraction of one
+    double minutes = std::chrono::duration<double>(at - last_refill).count() / 60.0;
+    double available = std::min(config.burst, tokens + std::max(0.0, minutes) * config.requests_per_minute);
+    if (available >= 1.0) return at;
+    double wait_s = (1.0 - available) / config.requests_per_minute * 60.0;
+    return at + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(wait_s));
+}
+
+RequestBudgetStats RequestBudget::Stats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    RequestBudgetStats copy = stats;
+    Clock::time_point now = Clock::now();
+    copy.tokens = Limited() ? tokens : -1.0;
+    copy.blocked_ms = now < blocked_until ?
+        std::chrono::duration<double, std::milli>(blocked_until - now).count() : 0.0;
+    return copy;
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include "HttpTransport.h"
+
+/**
+ * @brief Request rate allowed towards one price provider
+ */
+struct RequestBudgetConfig {
+    double requests_per_minute = 0.0;           // Token bucket refill rate (0 = no local limit)
+    double burst = 10.0;                        // Bucket capacity: requests that may go out back to back
+    std::chrono::milliseconds backoff_base{ 1000 }; // First backoff after a failure without Retry-After
+    std::chrono::milliseconds backoff_max{ 300000 }; // Cap on the exponential backoff
+};
+
+/**
+ * @brief What one response said about the provider's rate limit
+ */
+struct RateLimitSignal {
+    int status = 0;                             // HTTP status; 0 if no response arrived
+    int64_t retry_after_ms = -1;                // Retry-After (delay or HTTP date), -1 if absent
+    int64_t remaining = -1;                     // X-RateLimit-Remaining / RateLimit-Remaining, -1 if absent
+    int64_t reset_ms = -1;                      // Time until that window resets, -1 if absent
+
+    /**
+     * @brief Read the status and rate-limit headers of a response
+     *
+     * Retry-After may be delta-seconds or an IMF-fixdate. The reset header
+     * is taken as delta-seconds, or as Unix time when it is that large.
+     * @param now Wall clock used for absolute dates
+     */
+    static RateLimitSignal Read(const BodyStream& response, std::chrono::system_clock::time_point now);
+};
+
+/**
+ * @brief What the body of a response that was not refused turned out to hold
+ */
+enum class ResponseUse {
+    Unusable,                                   // A 4xx, or a body that did not parse: a failure
+    Empty,                                      // Parsed, but priced none of the requested coins
+    Quotes,                                     // Priced coins: the provider is healthy
+};
+
+/**
+ * @brief Counters of a RequestBudget
+ */
+struct RequestBudgetStats {
+    uint64_t sent = 0;                          // Requests that went out
+    uint64_t rejected = 0;                      // Requests held back (bucket empty or backing off)
+    uint64_t throttled = 0;                     // 429 answers
+    uint64_t backoffs = 0;                      // Backoff periods started
+    double tokens = 0.0;                        // Tokens in the bucket when read (-1 = no local limit)
+    double blocked_ms = 0.0;                    // Backoff left when read
+};
+
+/**
+ * @brief Token bucket plus adaptive backoff for one provider
+ *
+ * Acquire() hands out tokens at the configured rate. Responses are fed back
+ * through Record(): a 429 or a failure (no response, a 5xx or 4xx, or a
+ * body that did not parse) blocks the provider for Retry-After when the
+ * server sent one, otherwise for an exponentially growing delay with
+ * jitter, so several clients do not retry in lockstep. Only a response that
+ * priced coins resets that delay. A reported remaining quota caps the
+ * bucket; an exhausted one blocks until the reset.
+ * Thread-safe; fetch workers record their responses concurrently.
+ */
+class RequestBudget {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit RequestBudget(const RequestBudgetConfig& config);
+
+    /**
+     * @brief Take tokens for up to 'wanted' requests
+     * @return Requests that may be sent now; the rest count as rejected
+     */
+    size_t Acquire(size_t wanted, Clock::time_point now);
+
+    /**
+     * @brief Return tokens of requests that were granted but not sent (counted as rejected)
+     */
+    void Release(size_t unused);
+
+    /**
+     * @brief Whether requests may go out now (not backing off)
+     */
+    bool Open(Clock::time_point now) const;
+
+    /**
+     * @brief Feed back one response, or a request that got no response (status 0)
+     * @param use What the body yielded; ignored for 429s, 5xx and missing responses
+     */
+    void Record(const RateLimitSignal& signal, ResponseUse use, Clock::time_point now);
+
+    /**
+     * @brief Earliest time Acquire() grants at least one request ('now' if it would)
+     */
+    Clock::time_point NextAvailable(Clock::time_point now) const;
+
+    /**
+     * @brief Copy of the counters
+     */
+    RequestBudgetStats Stats() const;
+
+private:
+    /**
+     * @brief Add the tokens earned since the last refill (caller holds mutex)
+     */
+    void Refill(Clock::time_point now);
+
+    /**
+     * @brief Block requests after a failure or 429 (caller holds mutex)
+     * @param hint Delay the server asked for, or negative to back off exponentially
+     */
+    void BackOff(std::chrono::milliseconds hint, Clock::time_point now);
+
+    bool Limited() const { return config.requests_per_minute > 0.0; }
+
+    RequestBudgetConfig config;
+    mutable std::mutex mutex;                   // Guards everything below
+    double tokens;                              // Requests that may go out now
+    Clock::time_point last_refill;              // Tokens were last added at
+    Clock::time_point blocked_until;            // Backing off or quota exhausted until
+    unsigned failures = 0;                      // Consecutive failed or throttled responses
+    std::mt19937 jitter;                        // Spreads backoff delays
+    RequestBudgetStats stats;
+};
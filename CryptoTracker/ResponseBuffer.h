@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+/**
+ * @brief Reusable receive buffer for HTTP response bodies
+ *
+ * Transports read straight into the free tail of the buffer
+ * (PrepareWrite/CommitWrite) and the parser consumes the result through
+ * View(), so a response is never copied into an intermediate string.
+ * Clear() keeps the allocation, and growth is geometric, so after the
+ * first few polls a steady-state fetch performs no heap allocation.
+ */
+class ResponseBuffer {
+public:
+    /**
+     * @brief Constructor
+     * @param initial_capacity Bytes reserved up front
+     */
+    explicit ResponseBuffer(size_t initial_capacity = 64 * 1024)
+        : data(new char[initial_capacity]), size(0), capacity(initial_capacity) {
+    }
+
+    /**
+     * @brief Discard contents but keep the allocation
+     */
+    void Clear() { size = 0; }
+
+    /**
+     * @brief Ensure at least 'min_bytes' of free space after the contents
+     * @return Pointer to the free tail to read into
+     */
+    char* PrepareWrite(size_t min_bytes) {
+        if (capacity - size < min_bytes) {
+            Grow(size + min_bytes);
+        }
+        return data.get() + size;
+    }
+
+    /**
+     * @brief Mark 'bytes' written into the tail returned by PrepareWrite
+     */
+    void CommitWrite(size_t bytes) { size += bytes; }
+
+    /**
+     * @brief Drop the first 'bytes' bytes, moving the rest to the front
+     */
+    void Consume(size_t bytes) {
+        if (bytes >= size) {
+            size = 0;
+            return;
+        }
+        std::memmove(data.get(), data.get() + bytes, size - bytes);
+        size -= bytes;
+    }
+
+    /**
+     * @brief Read-only view of the buffered bytes
+     */
+    std::string_view View() const { return std::string_view(data.get(), size); }
+
+    size_t Size() const { return size; }
+    size_t Capacity() const { return capacity; }
+
+private:
+    void Grow(size_t required) {
+        size_t new_capacity = capacity * 2;
+        if (new_capacity < required) new_capacity = required;
+
+        std::unique_ptr<char[]> grown(new char[new_capacity]);
+        std::memcpy(grown.get(), data.get(), size);
+        data = std::move(grown);
+        capacity = new_capacity;
+    }
+
+    std::unique_ptr<char[]> data;   // Heap storage (uninitialized)
+    size_t size;                    // Bytes in use
+    size_t capacity;                // Bytes allocated
+};
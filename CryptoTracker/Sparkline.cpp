@@ -0,0 +1,97 @@
+#include "Sparkline.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+void DownsampleLttb(const PriceSample* samples, size_t count, size_t threshold, std::vector<PriceSample>& out) {
+    out.clear();
+    if (threshold >= count || threshold < 3) {
+        out.assign(samples, samples + count);
+        return;
+    }
+
+    // Times relative to the first sample keep full precision as doubles
+    const int64_t origin = samples[0].timestamp_ms;
+    auto x = [&](size_t i) { return static_cast<double>(samples[i].timestamp_ms - origin); };
+
+    const double bucket = static_cast<double>(count - 2) / static_cast<double>(threshold - 2);
+    size_t kept = 0;
+    out.push_back(samples[0]);
+
+    for (size_t b = 0; b < threshold - 2; ++b) {
+        // Average of the next bucket is the third triangle corner
+        size_t next_begin = static_cast<size_t>(static_cast<double>(b + 1) * bucket) + 1;
+        size_t next_end = std::min(static_cast<size_t>(static_cast<double>(b + 2) * bucket) + 1, count);
+        double avg_x = 0.0, avg_y = 0.0;
+        for (size_t i = next_begin; i < next_end; ++i) {
+            avg_x += x(i);
+            avg_y += samples[i].price;
+        }
+        double span = static_cast<double>(std::max<size_t>(next_end - next_begin, 1));
+        avg_x /= span;
+        avg_y /= span;
+
+        // Pick the sample of this bucket with the largest triangle
+        size_t begin = static_cast<size_t>(static_cast<double>(b) * bucket) + 1;
+        size_t end = static_cast<size_t>(static_cast<double>(b + 1) * bucket) + 1;
+        double ax = x(kept), ay = samples[kept].price;
+        double best_area = -1.0;
+        size_t best = begin;
+        for (size_t i = begin; i < end; ++i) {
+            double area = std::fabs((ax - avg_x) * (samples[i].price - ay) - (ax - x(i)) * (avg_y - ay));
+            if (area > best_area) {
+                best_area = area;
+                best = i;
+            }
+        }
+        out.push_back(samples[best]);
+        kept = best;
+    }
+
+    out.push_back(samples[count - 1]);
+}
+
+void SparklineCache::Bind(std::shared_ptr<const PriceHistory> history) {
+    if (this->history == history) return;
+
+    this->history = std::move(history);
+    entries.clear();
+    entries.resize(this->history ? this->history->Size() : 0);
+}
+
+const Sparkline& SparklineCache::Get(size_t index, int width) {
+    Sparkline& line = entries[index];
+    uint64_t appended = history->Appended(index);
+    if (line.appended == appended && line.width == width) {
+        return line;
+    }
+    line.appended = appended;
+    line.width = width;
+    line.points.clear();
+    ++rebuilds;
+
+    history->ReadWindow(index, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(), window);
+    if (window.size() < 2 || width < 2) {
+        return line;
+    }
+    DownsampleLttb(window.data(), window.size(), static_cast<size_t>(width), reduced);
+
+    // Normalize into the unit square; a flat series is drawn through the middle
+    double low = reduced[0].price, high = reduced[0].price;
+    for (const PriceSample& sample : reduced) {
+        low = std::min(low, sample.price);
+        high = std::max(high, sample.price);
+    }
+    double t0 = static_cast<double>(reduced.front().timestamp_ms);
+    double t_span = static_cast<double>(reduced.back().timestamp_ms) - t0;
+    double p_span = high - low;
+    for (size_t i = 0; i < reduced.size(); ++i) {
+        float px = t_span > 0.0 ?
+            static_cast<float>((static_cast<double>(reduced[i].timestamp_ms) - t0) / t_span) :
+            static_cast<float>(i) / static_cast<float>(reduced.size() - 1);
+        float py = p_span > 0.0 ? static_cast<float>((reduced[i].price - low) / p_span) : 0.5f;
+        line.points.push_back({ px, py });
+    }
+    line.rising = reduced.back().price >= reduced.front().price;
+    return line;
+}
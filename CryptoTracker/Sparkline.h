@@ -0,0 +1,73 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "PriceHistory.h"
+
+/**
+ * @brief Largest-Triangle-Three-Buckets downsampling
+ *
+ * Keeps the first and last sample and, for each of 'threshold - 2' equal
+ * buckets in between, the sample forming the largest triangle with the
+ * previously kept sample and the average of the next bucket. Peaks and
+ * dips survive far better than with plain decimation or averaging.
+ * Series shorter than 'threshold' (or thresholds below 3) are copied as is.
+ * @param out Cleared, then filled with at most 'threshold' samples
+ */
+void DownsampleLttb(const PriceSample* samples, size_t count, size_t threshold, std::vector<PriceSample>& out);
+
+/**
+ * @brief Point of a sparkline, normalized to [0, 1] on both axes (y up)
+ */
+struct SparkPoint {
+    float x;
+    float y;
+};
+
+/**
+ * @brief Downsampled, normalized price series of one coin
+ */
+struct Sparkline {
+    uint64_t appended = UINT64_MAX;     // PriceHistory::Appended() the points were built from
+    int width = 0;                      // Pixel width (= LTTB threshold) the points were built for
+    bool rising = true;                 // Last price >= first price
+    std::vector<SparkPoint> points;     // Empty if fewer than two samples
+};
+
+/**
+ * @brief Per-coin cache of sparklines over a PriceHistory
+ *
+ * Sized to the history's catalog; an entry is rebuilt (window read + LTTB)
+ * only when its coin received new ticks or the requested width changed,
+ * so frames that redraw unchanged rows only check one counter per row.
+ */
+class SparklineCache {
+public:
+    /**
+     * @brief Drop all entries if the history changed (nullptr disables sparklines)
+     */
+    void Bind(std::shared_ptr<const PriceHistory> history);
+
+    /**
+     * @brief History the entries are built from (may be null)
+     */
+    const PriceHistory* History() const { return history.get(); }
+
+    /**
+     * @brief Sparkline of a coin for a cell 'width' pixels wide, rebuilt if stale
+     */
+    const Sparkline& Get(size_t index, int width);
+
+    /**
+     * @brief Entries rebuilt so far
+     */
+    uint64_t Rebuilds() const { return rebuilds; }
+
+private:
+    std::shared_ptr<const PriceHistory> history;    // Source of the series
+    std::vector<Sparkline> entries;                 // One per coin
+    std::vector<PriceSample> window;                // Scratch: full ring of one coin
+    std::vector<PriceSample> reduced;               // Scratch: LTTB output
+    uint64_t rebuilds = 0;
+};
@@ -0,0 +1,554 @@
+#include "TickLog.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr char SEGMENT_MAGIC[8] = { 'C', 'T', 'T', 'I', 'C', 'K', '0', '1' };
+constexpr char INDEX_MAGIC[8] = { 'C', 'T', 'T', 'I', 'D', 'X', '0', '1' };
+
+/**
+ * @brief First bytes of every segment file
+ */
+struct SegmentHeader {
+    char magic[8];
+    uint32_t record_size;
+    uint32_t reserved;
+    uint64_t number;
+    uint64_t reserved2;
+};
+static_assert(sizeof(SegmentHeader) == TickLog::HEADER_SIZE, "Header keeps records aligned");
+
+/**
+ * @brief First bytes of a sealed segment's .idx file, followed by the sparse timestamps
+ */
+struct IndexHeader {
+    char magic[8];
+    uint64_t records;
+    int64_t first_ts;
+    int64_t last_ts;
+};
+
+uint64_t RecordCheck(const TickRecord& record) {
+    uint64_t price_bits;
+    std::memcpy(&price_bits, &record.price, sizeof(price_bits));
+
+    // Non-zero for all-zero input, so a hole left by a crash never validates
+    uint64_t h = 0x9E3779B97F4A7C15ull;
+    for (uint64_t v : { static_cast<uint64_t>(record.timestamp_ms), price_bits, record.coin_key }) {
+        h ^= v;
+        h *= 0xBF58476D1CE4E5B9ull;
+        h ^= h >> 31;
+    }
+    return h | 1;
+}
+
+const TickRecord* Records(const MappedFile& map) {
+    return reinterpret_cast<const TickRecord*>(map.Data() + TickLog::HEADER_SIZE);
+}
+
+bool ParseSegmentName(const fs::path& path, uint64_t& number) {
+    std::string name = path.filename().string();
+    if (name.size() != 18 || name.compare(0, 6, "ticks-") != 0 || path.extension() != ".log") {
+        return false;
+    }
+    number = std::strtoull(name.c_str() + 6, nullptr, 10);
+    return number != 0;
+}
+
+/**
+ * @brief Records a sealed segment's .idx file covers, UINT64_MAX without a valid one
+ */
+uint64_t IndexedRecords(const fs::path& segment_path) {
+    fs::path path = segment_path;
+    path.replace_extension(".idx");
+    std::ifstream in(path, std::ios::binary);
+    IndexHeader header{};
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0) {
+        return UINT64_MAX;
+    }
+    return header.records;
+}
+
+fs::path SegmentPath(const fs::path& directory, uint64_t number) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "ticks-%08llu.log", static_cast<unsigned long long>(number));
+    return directory / name;
+}
+
+bool SyncFile(std::FILE* file) {
+    if (std::fflush(file) != 0) {
+        return false;
+    }
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#elif defined(__APPLE__)
+    return fsync(fileno(file)) == 0;
+#else
+    return fdatasync(fileno(file)) == 0;
+#endif
+}
+
+} // namespace
+
+uint64_t TickLog::CoinKey(std::string_view coin_id) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (char c : coin_id) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+TickLog::TickLog(const TickLogOptions& options)
+    : options(options) {
+    std::error_code ec;
+    fs::create_directories(this->options.directory, ec);
+    OpenExisting();
+    writer_thread = std::thread(&TickLog::WriterThreadFunc, this);
+}
+
+TickLog::~TickLog() {
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex);
+        stop = true;
+    }
+    pending_cv.notify_all();
+    if (writer_thread.joinable()) {
+        writer_thread.join();
+    }
+    if (active_file) {
+        std::fclose(active_file);
+    }
+}
+
+void TickLog::OpenExisting() {
+    std::vector<std::pair<uint64_t, fs::path>> files;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(options.directory, ec)) {
+        uint64_t number;
+        if (entry.is_regular_file(ec) && ParseSegmentName(entry.path(), number)) {
+            files.emplace_back(number, entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    for (size_t f = 0; f < files.size(); ++f) {
+        auto segment = std::make_shared<Segment>();
+        segment->number = files[f].first;
+        segment->path = files[f].second;
+        bool is_last = f + 1 == files.size();
+
+        uint64_t size = fs::file_size(segment->path, ec);
+        SegmentHeader header{};
+        std::ifstream in(segment->path, std::ios::binary);
+        if (ec || !in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            std::memcmp(header.magic, SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC)) != 0 ||
+            header.record_size != sizeof(TickRecord)) {
+            // Crashed while creating the segment, or not ours
+            in.close();
+            if (is_last && size < HEADER_SIZE) {
+                fs::remove(segment->path, ec);
+            }
+            continue;
+        }
+        in.close();
+
+        // A sealed segment holds what its index says; more bytes are from a write that
+        // failed and could not be truncated before the segment was sealed
+        uint64_t indexed = IndexedRecords(segment->path);
+        segment->records = std::min((size - HEADER_SIZE) / sizeof(TickRecord), indexed);
+        bool torn_tail_possible = is_last || indexed != segment->records;
+        if (segment->records > 0) {
+            segment->map = MappedFile::Open(segment->path, HEADER_SIZE + segment->records * sizeof(TickRecord));
+            if (!segment->map) continue;
+        }
+
+        // Only the last segment, or one sealed without its index, can end in a torn write:
+        // keep records up to the first one that does not validate within the tail
+        // (unsynced pages may reach disk out of order)
+        if (torn_tail_possible && segment->map) {
+            const TickRecord* records = Records(*segment->map);
+            uint64_t start = segment->records > TAIL_CHECK_RECORDS ? segment->records - TAIL_CHECK_RECORDS : 0;
+            for (uint64_t r = start; r < segment->records; ++r) {
+                if (records[r].check != RecordCheck(records[r])) {
+                    segment->records = r;
+                    break;
+                }
+            }
+        }
+        uint64_t valid_size = HEADER_SIZE + segment->records * sizeof(TickRecord);
+        if (valid_size != size) {
+            segment->map.reset();   // Windows cannot truncate a mapped file
+            fs::resize_file(segment->path, valid_size, ec);
+            stats.recovered_bytes += size - valid_size;
+            segment->map = segment->records > 0 ? MappedFile::Open(segment->path, valid_size) : nullptr;
+        }
+
+        // Sealed segments carry an index; otherwise sample every INDEX_STRIDE-th record in place
+        if (!ReadIndex(*segment) && segment->map) {
+            const TickRecord* records = Records(*segment->map);
+            segment->first_ts = records[0].timestamp_ms;
+            segment->last_ts = records[segment->records - 1].timestamp_ms;
+            segment->sparse.clear();
+            for (uint64_t r = 0; r < segment->records; r += INDEX_STRIDE) {
+                segment->sparse.push_back(records[r].timestamp_ms);
+            }
+        }
+        segments.push_back(std::move(segment));
+    }
+
+    for (const auto& segment : segments) {
+        if (segment->records > 0) last_timestamp = std::max(last_timestamp, segment->last_ts);
+    }
+
+    // Keep appending to the last segment
+    if (!segments.empty() && segments.back()->records < RecordsPerSegment()) {
+        active_file = std::fopen(segments.back()->path.string().c_str(), "ab");
+    }
+}
+
+bool TickLog::ReadIndex(Segment& segment) const {
+    fs::path path = segment.path;
+    path.replace_extension(".idx");
+    std::ifstream in(path, std::ios::binary);
+    IndexHeader header{};
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0 ||
+        header.records != segment.records) {
+        return false;
+    }
+
+    std::vector<int64_t> sparse((segment.records + INDEX_STRIDE - 1) / INDEX_STRIDE);
+    if (!in.read(reinterpret_cast<char*>(sparse.data()), sparse.size() * sizeof(int64_t))) {
+        return false;
+    }
+    segment.first_ts = header.first_ts;
+    segment.last_ts = header.last_ts;
+    segment.sparse = std::move(sparse);
+    return true;
+}
+
+void TickLog::WriteIndex(const Segment& segment) const {
+    fs::path path = segment.path;
+    path.replace_extension(".idx");
+    fs::path temp = path;
+    temp += ".tmp";
+
+    IndexHeader header{};
+    std::memcpy(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    header.records = segment.records;
+    header.first_ts = segment.first_ts;
+    header.last_ts = segment.last_ts;
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(segment.sparse.data()), segment.sparse.size() * sizeof(int64_t));
+        if (!out) return;
+    }
+    std::error_code ec;
+    fs::rename(temp, path, ec);
+}
+
+bool TickLog::Rotate() {
+    std::shared_ptr<Segment> sealed;
+    uint64_t number = 1;
+    {
+        std::lock_guard<std::mutex> lock(segments_mutex);
+        if (!segments.empty()) {
+            sealed = segments.back();
+            number = sealed->number + 1;
+        }
+    }
+    if (active_file) {
+        std::fclose(active_file);
+        active_file = nullptr;
+    }
+    if (sealed && sealed->records > 0) {
+        // Only the writer thread changes a segment's index, so no lock is needed to read it here
+        WriteIndex(*sealed);
+    }
+
+    auto segment = std::make_shared<Segment>();
+    segment->number = number;
+    segment->path = SegmentPath(options.directory, number);
+
+    SegmentHeader header{};
+    std::memcpy(header.magic, SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC));
+    header.record_size = sizeof(TickRecord);
+    header.number = number;
+
+    active_file = std::fopen(segment->path.string().c_str(), "wb");
+    if (!active_file) {
+        return false;
+    }
+    if (std::fwrite(&header, sizeof(header), 1, active_file) != 1 || !SyncFile(active_file)) {
+        std::fclose(active_file);
+        active_file = nullptr;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(segments_mutex);
+    segments.push_back(std::move(segment));
+    return true;
+}
+
+void TickLog::WriteBatch(std::vector<TickRecord>& batch) {
+    // The sparse index and the readers' early exit need records in time order;
+    // ticks stamped by a wall clock that stepped back keep the last logged time
+    for (TickRecord& record : batch) {
+        record.timestamp_ms = std::max(record.timestamp_ms, last_timestamp);
+        last_timestamp = record.timestamp_ms;
+        record.check = RecordCheck(record);
+    }
+
+    const uint64_t capacity = RecordsPerSegment();
+    size_t offset = 0;
+    bool failed = false;
+    while (offset < batch.size()) {
+        std::shared_ptr<Segment> segment;
+        {
+            std::lock_guard<std::mutex> lock(segments_mutex);
+            if (!segments.empty()) segment = segments.back();
+        }
+        if (!active_file || !segment || segment->records >= capacity) {
+            if (!Rotate()) {
+                failed = true;
+                break;
+            }
+            continue;
+        }
+
+        size_t count = static_cast<size_t>(std::min<uint64_t>(capacity - segment->records, batch.size() - offset));
+        if (std::fwrite(&batch[offset], sizeof(TickRecord), count, active_file) != count ||
+            (options.sync_writes ? !SyncFile(active_file) : std::fflush(active_file) != 0)) {
+            // Cut off whatever part of the batch reached the file before the segment is
+            // sealed. If that fails too (a reader maps it on Windows), OpenExisting()
+            // still keeps only the records the segment's index counts.
+            std::fclose(active_file);
+            active_file = nullptr;
+            failed = true;
+            {
+                std::lock_guard<std::mutex> lock(segments_mutex);
+                segment->map.reset();   // Readers remap on demand
+            }
+            std::error_code ec;
+            fs::resize_file(segment->path, HEADER_SIZE + segment->records * sizeof(TickRecord), ec);
+            break;
+        }
+
+        // Publish the records to readers only once they are on disk
+        std::lock_guard<std::mutex> lock(segments_mutex);
+        if (segment->records == 0) {
+            segment->first_ts = batch[offset].timestamp_ms;
+        }
+        for (uint64_t r = segment->records; r < segment->records + count; ++r) {
+            if (r % INDEX_STRIDE == 0) {
+                segment->sparse.push_back(batch[offset + (r - segment->records)].timestamp_ms);
+            }
+        }
+        segment->records += count;
+        segment->last_ts = batch[offset + count - 1].timestamp_ms;
+        offset += count;
+    }
+
+    std::lock_guard<std::mutex> lock(segments_mutex);
+    ++stats.batches_written;
+    if (failed) ++stats.write_errors;
+}
+
+void TickLog::EnforceRetention() {
+    std::vector<std::shared_ptr<Segment>> expired;
+    {
+        std::lock_guard<std::mutex> lock(segments_mutex);
+        uint64_t total = 0;
+        for (const auto& segment : segments) {
+            total += HEADER_SIZE + segment->records * sizeof(TickRecord);
+        }
+        size_t drop = 0;
+        while (total > options.max_total_bytes && segments.size() - drop > 1) {
+            total -= HEADER_SIZE + segments[drop]->records * sizeof(TickRecord);
+            ++drop;
+        }
+        expired.assign(segments.begin(), segments.begin() + drop);
+        segments.erase(segments.begin(), segments.begin() + drop);
+    }
+
+    // Unmap before deleting: Windows refuses to delete a mapped file. Collect()
+    // can no longer reach these segments, but a reader may still hold a mapping;
+    // its file is then retried on later passes.
+    for (const auto& segment : expired) {
+        segment->map.reset();
+        fs::path index = segment->path;
+        index.replace_extension(".idx");
+        undeleted.push_back(segment->path);
+        undeleted.push_back(std::move(index));
+    }
+    undeleted.erase(std::remove_if(undeleted.begin(), undeleted.end(), [](const fs::path& path) {
+        std::error_code ec;
+        fs::remove(path, ec);
+        return !ec;     // Removed, or already gone
+    }), undeleted.end());
+}
+
+void TickLog::WriterThreadFunc() {
+    std::vector<TickRecord> batch;
+    for (;;) {
+        uint64_t taken = 0;
+        {
+            std::unique_lock<std::mutex> lock(pending_mutex);
+            pending_cv.wait(lock, [&] { return stop || !pending.empty(); });
+            if (pending.empty()) {
+                return;
+            }
+            batch.swap(pending);
+            taken = appended_batches;
+        }
+
+        WriteBatch(batch);
+        EnforceRetention();
+        batch.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(pending_mutex);
+            written_batches = taken;
+        }
+        written_cv.notify_all();
+    }
+}
+
+void TickLog::Append(std::vector<TickRecord> batch) {
+    if (batch.empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex);
+        if (pending.empty()) {
+            pending.swap(batch);
+        }
+        else {
+            pending.insert(pending.end(), batch.begin(), batch.end());
+        }
+        ++appended_batches;
+    }
+    pending_cv.notify_one();
+}
+
+void TickLog::Flush() {
+    std::unique_lock<std::mutex> lock(pending_mutex);
+    uint64_t target = appended_batches;
+    written_cv.wait(lock, [&] { return written_batches >= target; });
+}
+
+std::vector<TickLog::Range> TickLog::Collect(int64_t from_ms, int64_t to_ms) const {
+    std::vector<Range> ranges;
+    std::lock_guard<std::mutex> lock(segments_mutex);
+    for (const auto& segment : segments) {
+        if (segment->records == 0 || segment->last_ts < from_ms || segment->first_ts > to_ms) {
+            continue;
+        }
+
+        // The active segment grows; remap when the mapping no longer covers it
+        size_t length = HEADER_SIZE + segment->records * sizeof(TickRecord);
+        if (!segment->map || segment->map->Size() < length) {
+            segment->map = MappedFile::Open(segment->path, length);
+            if (!segment->map) continue;
+        }
+
+        // Start at the last sparse entry before 'from_ms'
+        auto it = std::lower_bound(segment->sparse.begin(), segment->sparse.end(), from_ms);
+        size_t block = it == segment->sparse.begin() ? 0 : static_cast<size_t>(it - segment->sparse.begin()) - 1;
+
+        Range range;
+        range.map = segment->map;
+        range.begin = block * INDEX_STRIDE;
+        range.end = segment->records;
+        ranges.push_back(std::move(range));
+    }
+    return ranges;
+}
+
+size_t TickLog::Read(uint64_t coin_key, int64_t from_ms, int64_t to_ms, std::vector<PriceSample>& out) const {
+    out.clear();
+    for (const Range& range : Collect(from_ms, to_ms)) {
+        const TickRecord* records = Records(*range.map);
+        for (uint64_t r = range.begin; r < range.end; ++r) {
+            const TickRecord& record = records[r];
+            if (record.timestamp_ms > to_ms) break;
+            if (record.coin_key == coin_key && record.timestamp_ms >= from_ms) {
+                out.push_back({ record.timestamp_ms, record.price });
+            }
+        }
+    }
+    return out.size();
+}
+
+void TickLog::ForEach(int64_t from_ms, int64_t to_ms, const std::function<void(const TickRecord&)>& visit) const {
+    for (const Range& range : Collect(from_ms, to_ms)) {
+        const TickRecord* records = Records(*range.map);
+        for (uint64_t r = range.begin; r < range.end; ++r) {
+            const TickRecord& record = records[r];
+            if (record.timestamp_ms > to_ms) break;
+            if (record.timestamp_ms >= from_ms) {
+                visit(record);
+            }
+        }
+    }
+}
+
+size_t TickLog::Replay(PriceHistory& rings, int64_t from_ms) const {
+    if (rings.Capacity() == 0) {
+        return 0;
+    }
+
+    std::vector<uint64_t> keys(rings.Size());
+    std::unordered_map<uint64_t, size_t> slots;
+    slots.reserve(rings.Size());
+    for (size_t i = 0; i < rings.Size(); ++i) {
+        keys[i] = CoinKey(rings.Catalog().Id(i));
+        slots.emplace(keys[i], i);
+    }
+
+    // A tick is logged in catalog order, so the next record is usually the next coin
+    size_t appended = 0;
+    size_t next = 0;
+    ForEach(from_ms, INT64_MAX, [&](const TickRecord& record) {
+        size_t index;
+        if (next < keys.size() && keys[next] == record.coin_key) {
+            index = next;
+        }
+        else {
+            auto it = slots.find(record.coin_key);
+            if (it == slots.end()) return;
+            index = it->second;
+        }
+        rings.Append(index, record.timestamp_ms, record.price);
+        next = index + 1;
+        ++appended;
+    });
+    return appended;
+}
+
+TickLogStats TickLog::GetStats() const {
+    std::lock_guard<std::mutex> lock(segments_mutex);
+    TickLogStats result = stats;
+    result.segments = segments.size();
+    for (const auto& segment : segments) {
+        result.records += segment->records;
+        result.bytes += HEADER_SIZE + segment->records * sizeof(TickRecord);
+    }
+    return result;
+}
@@ -0,0 +1,211 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "MappedFile.h"
+#include "PriceHistory.h"
+
+/**
+ * @brief One persisted price tick (fixed size, stored as-is on disk)
+ */
+struct TickRecord {
+    int64_t timestamp_ms = 0;   // Time the price was applied (ms since epoch)
+    double price = 0.0;         // USD price
+    uint64_t coin_key = 0;      // TickLog::CoinKey of the CoinGecko ID
+    uint64_t check = 0;         // Filled by the log; detects torn records after a crash
+};
+static_assert(sizeof(TickRecord) == 32, "TickRecord is an on-disk format");
+
+/**
+ * @brief Location and limits of a TickLog
+ */
+struct TickLogOptions {
+    std::filesystem::path directory{ "data/ticks" };    // Segment and index files
+    size_t segment_bytes = 64 * 1024 * 1024;            // Size at which a segment is sealed
+    size_t max_total_bytes = 1024ull * 1024 * 1024;     // Oldest segments are deleted beyond this
+    bool sync_writes = true;                            // Flush each batch to stable storage
+};
+
+/**
+ * @brief Counters of a TickLog
+ */
+struct TickLogStats {
+    size_t segments = 0;            // Segment files in use
+    uint64_t records = 0;           // Records across all segments
+    uint64_t bytes = 0;             // Bytes across all segment files
+    uint64_t batches_written = 0;   // Batches written since open
+    uint64_t write_errors = 0;      // Batches (partly) lost to I/O errors
+    uint64_t recovered_bytes = 0;   // Torn tail bytes truncated at open
+};
+
+/**
+ * @brief Append-only, segmented binary log of price ticks
+ *
+ * Records go to numbered segment files (ticks-00000001.log, ...), each a
+ * 32-byte header followed by fixed-size TickRecords in time order (a record
+ * stamped earlier than the last one logged, e.g. after the system clock
+ * stepped back, is logged at that last time). A full
+ * segment is sealed and gets a small .idx file: record count, first/last
+ * timestamp and the timestamp of every INDEX_STRIDE-th record. Opening the
+ * log reads only those index files (or, for a segment without one, every
+ * INDEX_STRIDE-th record through a mapping) and validates the tail of the
+ * last segment and of any sealed without its index, truncating a record
+ * torn by a crash mid-write. A write that fails is cut off at once.
+ *
+ * Append() only hands the batch to a writer thread, which writes and syncs
+ * it. Reads map the segments overlapping the requested window, seek with
+ * the sparse index and scan records in place; nothing is parsed or copied
+ * except the matching samples.
+ */
+class TickLog {
+public:
+    static constexpr size_t HEADER_SIZE = 32;       // Segment header, keeps records 32-byte aligned
+    static constexpr size_t INDEX_STRIDE = 4096;    // Records per sparse index entry
+    static constexpr size_t TAIL_CHECK_RECORDS = 65536; // Records validated at the end of a segment that may be torn
+
+    /**
+     * @brief Stable key of a coin ID (64-bit FNV-1a)
+     */
+    static uint64_t CoinKey(std::string_view coin_id);
+
+    /**
+     * @brief Open (creating if needed) the log in options.directory and start the writer
+     */
+    explicit TickLog(const TickLogOptions& options);
+
+    /**
+     * @brief Write what is still pending and stop the writer
+     */
+    ~TickLog();
+
+    TickLog(const TickLog&) = delete;
+    TickLog& operator=(const TickLog&) = delete;
+
+    /**
+     * @brief Queue records for writing (non-blocking)
+     * @param batch Records in time order; 'check' is filled in by the writer
+     */
+    void Append(std::vector<TickRecord> batch);
+
+    /**
+     * @brief Block until every record appended so far has been written
+     */
+    void Flush();
+
+    /**
+     * @brief Copy one coin's samples with from_ms <= timestamp <= to_ms, oldest first
+     * @param out Cleared, then filled
+     * @return Number of samples written to 'out'
+     */
+    size_t Read(uint64_t coin_key, int64_t from_ms, int64_t to_ms, std::vector<PriceSample>& out) const;
+
+    /**
+     * @brief Visit every record with from_ms <= timestamp <= to_ms in log order
+     */
+    void ForEach(int64_t from_ms, int64_t to_ms, const std::function<void(const TickRecord&)>& visit) const;
+
+    /**
+     * @brief Append logged ticks from 'from_ms' on into the rings of the coins they belong to
+     *
+     * Used to refill empty PriceHistory rings at startup or after a coin-list change.
+     * @return Records appended
+     */
+    size_t Replay(PriceHistory& rings, int64_t from_ms) const;
+
+    /**
+     * @brief Segment, record and error counters
+     */
+    TickLogStats GetStats() const;
+
+private:
+    /**
+     * @brief One segment file and its in-memory index (guarded by segments_mutex)
+     */
+    struct Segment {
+        uint64_t number = 0;                        // File sequence number
+        std::filesystem::path path;                 // .log file
+        uint64_t records = 0;                       // Records written and synced
+        int64_t first_ts = 0;                       // Timestamp of the first record
+        int64_t last_ts = 0;                        // Timestamp of the last record
+        std::vector<int64_t> sparse;                // Timestamp of every INDEX_STRIDE-th record
+        std::shared_ptr<const MappedFile> map;      // Read mapping (may cover fewer records)
+    };
+
+    /**
+     * @brief Records of one segment that may fall in a window
+     */
+    struct Range {
+        std::shared_ptr<const MappedFile> map;
+        uint64_t begin = 0;
+        uint64_t end = 0;
+    };
+
+    /**
+     * @brief Map and seek every segment overlapping [from_ms, to_ms]
+     */
+    std::vector<Range> Collect(int64_t from_ms, int64_t to_ms) const;
+
+    /**
+     * @brief Recover existing segments (truncate a torn tail, load or rebuild indexes)
+     */
+    void OpenExisting();
+
+    /**
+     * @brief Load a sealed segment's .idx file
+     * @return false if missing or not matching the segment
+     */
+    bool ReadIndex(Segment& segment) const;
+
+    /**
+     * @brief Write a sealed segment's .idx file (atomically via rename)
+     */
+    void WriteIndex(const Segment& segment) const;
+
+    /**
+     * @brief Seal the active segment (if any) and start the next one
+     */
+    bool Rotate();
+
+    /**
+     * @brief Write one batch on the writer thread
+     */
+    void WriteBatch(std::vector<TickRecord>& batch);
+
+    /**
+     * @brief Delete the oldest segments while the log exceeds max_total_bytes
+     *
+     * Files that cannot be deleted yet (still mapped by a reader on Windows)
+     * are retried on the next call.
+     */
+    void EnforceRetention();
+
+    /**
+     * @brief Writer loop: waits for batches or stop
+     */
+    void WriterThreadFunc();
+
+    uint64_t RecordsPerSegment() const { return (options.segment_bytes - HEADER_SIZE) / sizeof(TickRecord); }
+
+    TickLogOptions options;
+    mutable std::mutex segments_mutex;              // Guards 'segments' and their fields
+    std::vector<std::shared_ptr<Segment>> segments; // Oldest first; the last one is written to
+    TickLogStats stats;                             // Counters (guarded by segments_mutex)
+    std::FILE* active_file = nullptr;               // Last segment opened for append (writer thread only)
+    std::vector<std::filesystem::path> undeleted;   // Expired files whose removal failed (writer thread only)
+    int64_t last_timestamp = INT64_MIN;             // Newest timestamp logged; later records never go below it
+    std::mutex pending_mutex;                       // Guards the queue state below
+    std::condition_variable pending_cv;             // Wakes the writer
+    std::condition_variable written_cv;             // Signals Flush() callers
+    std::vector<TickRecord> pending;                // Records waiting for the writer
+    uint64_t appended_batches = 0;                  // Batches handed to Append()
+    uint64_t written_batches = 0;                   // Batches the writer has finished
+    bool stop = false;                              // Writer exits once 'pending' is empty
+    std::thread writer_thread;                      // Background writer
+};
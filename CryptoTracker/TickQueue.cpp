@@ -0,0 +1,145 @@
+#include "TickQueue.h"
+#include <algorithm>
+#include <bit>
+
+TickQueue::TickQueue(std::shared_ptr<const CoinCatalog> catalog, size_t capacity)
+    : catalog(std::move(catalog)) {
+    size_t coins = this->catalog->Size();
+    ring.resize(std::bit_ceil(std::max<size_t>(capacity, 2)));
+    mask = ring.size() - 1;
+    latest = std::make_unique<Latest[]>(coins);
+    dirty_words = (coins + 63) / 64;
+    dirty = std::make_unique<std::atomic<uint64_t>[]>(dirty_words);
+    for (size_t w = 0; w < dirty_words; ++w) {
+        dirty[w].store(0, std::memory_order_relaxed);
+    }
+    newest.assign(coins, Delivered());
+}
+
+void TickQueue::Push(PriceUpdate update) {
+    update.sequence = next_sequence++;
+    pushed.store(pushed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    uint64_t position = head.load(std::memory_order_relaxed);
+    if (position - cached_tail >= ring.size()) {
+        cached_tail = tail.load(std::memory_order_acquire);
+        if (position - cached_tail >= ring.size()) {
+            Conflate(update);       // Consumer is behind: keep only the latest per coin
+            return;
+        }
+    }
+    ring[position & mask] = update;
+    head.store(position + 1, std::memory_order_release);
+}
+
+void TickQueue::Conflate(const PriceUpdate& update) {
+    Latest& entry = latest[update.slot];
+    uint32_t version = entry.version.load(std::memory_order_relaxed);
+    entry.version.store(version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    entry.sequence.store(update.sequence, std::memory_order_relaxed);
+    entry.timestamp_ms.store(update.timestamp_ms, std::memory_order_relaxed);
+    entry.price.store(update.price, std::memory_order_relaxed);
+    entry.change_24h.store(update.change_24h, std::memory_order_relaxed);
+    entry.version.store(version + 2, std::memory_order_release);
+
+    // Values are the coin's current ones, but fields accumulate until the
+    // consumer takes them, so a move is never overwritten by a later update
+    // of another field. Flag the coin only after that: a consumer that took
+    // the fields before this OR finds the bit set again on its next Drain().
+    entry.fields.fetch_or(update.fields, std::memory_order_acq_rel);
+    dirty[update.slot / 64].fetch_or(uint64_t{ 1 } << (update.slot % 64), std::memory_order_release);
+    conflated_pending.store(true, std::memory_order_release);
+    conflated.store(conflated.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+bool TickQueue::TakeLatest(uint32_t slot, PriceUpdate& update) {
+    Latest& entry = latest[slot];
+
+    // Take the fields before the values: values read after them are at least
+    // as new as the updates that moved them
+    update.fields = entry.fields.exchange(0, std::memory_order_acq_rel);
+    for (;;) {
+        uint32_t before = entry.version.load(std::memory_order_acquire);
+        if (before & 1) continue;   // Producer mid-write; it never blocks, so this is brief
+
+        update.sequence = entry.sequence.load(std::memory_order_relaxed);
+        update.timestamp_ms = entry.timestamp_ms.load(std::memory_order_relaxed);
+        update.price = entry.price.load(std::memory_order_relaxed);
+        update.change_24h = entry.change_24h.load(std::memory_order_relaxed);
+        update.slot = slot;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (entry.version.load(std::memory_order_relaxed) == before) {
+            return update.sequence != 0;
+        }
+    }
+}
+
+void TickQueue::Deliver(const PriceUpdate& update, std::vector<PriceUpdate>& out) {
+    Delivered& coin = newest[update.slot];
+    if (update.sequence <= coin.update.sequence) {
+        // The update delivered instead carries the coin's current values; have
+        // it report the fields this one moved too, or a consumer that only
+        // looks at flagged fields would miss the move. An earlier Drain()
+        // delivered it if it is not in 'out': report it again. Equal sequences
+        // are table entries flagged again after their fields were taken.
+        if (update.sequence < coin.update.sequence) {
+            superseded.store(superseded.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+        if (update.fields == 0) {
+            return;
+        }
+        if (coin.position < out.size() && out[coin.position].sequence == coin.update.sequence) {
+            out[coin.position].fields |= update.fields;
+            return;
+        }
+        PriceUpdate again = coin.update;
+        again.fields = update.fields;
+        coin.position = out.size();
+        out.push_back(again);
+        return;
+    }
+    coin.update = update;
+    coin.position = out.size();
+    out.push_back(update);
+}
+
+size_t TickQueue::Drain(std::vector<PriceUpdate>& out) {
+    out.clear();
+
+    // Coins conflated while the ring was full first: their entries are
+    // usually newer than what the ring still holds for them
+    if (conflated_pending.exchange(false, std::memory_order_acquire)) {
+        PriceUpdate update;
+        for (size_t w = 0; w < dirty_words; ++w) {
+            uint64_t bits = dirty[w].exchange(0, std::memory_order_acquire);
+            while (bits != 0) {
+                uint32_t slot = static_cast<uint32_t>(w * 64 + std::countr_zero(bits));
+                bits &= bits - 1;
+                if (TakeLatest(slot, update)) {
+                    Deliver(update, out);
+                }
+            }
+        }
+    }
+
+    // Then everything the producer published to the ring up to now
+    uint64_t position = tail.load(std::memory_order_relaxed);
+    cached_head = head.load(std::memory_order_acquire);
+    for (; position != cached_head; ++position) {
+        Deliver(ring[position & mask], out);
+    }
+    tail.store(position, std::memory_order_release);
+
+    delivered.store(delivered.load(std::memory_order_relaxed) + out.size(), std::memory_order_relaxed);
+    return out.size();
+}
+
+TickQueueStats TickQueue::Stats() const {
+    TickQueueStats stats;
+    stats.pushed = pushed.load(std::memory_order_relaxed);
+    stats.conflated = conflated.load(std::memory_order_relaxed);
+    stats.delivered = delivered.load(std::memory_order_relaxed);
+    stats.superseded = superseded.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -0,0 +1,147 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "CoinCatalog.h"
+
+/**
+ * @brief One price update handed from the fetch thread to a consumer
+ */
+struct PriceUpdate {
+    uint64_t sequence = 0;          // Queue-wide push order
+    int64_t timestamp_ms = 0;       // Time stamped on the price
+    double price = 0.0;
+    double change_24h = 0.0;
+    uint32_t slot = 0;              // Coin index in the queue's catalog
+    uint8_t fields = 0;             // StagedQuote::HAS_PRICE | HAS_CHANGE
+};
+
+/**
+ * @brief Counters of a TickQueue
+ */
+struct TickQueueStats {
+    uint64_t pushed = 0;            // Updates the producer handed in
+    uint64_t conflated = 0;         // Pushed while the ring was full (kept as latest per coin)
+    uint64_t delivered = 0;         // Updates handed to the consumer
+    uint64_t superseded = 0;        // Merged into a newer update of the coin that was delivered
+};
+
+/**
+ * @brief Bounded single-producer/single-consumer queue of price updates
+ *
+ * A power-of-two ring with the producer's and the consumer's positions on
+ * separate cache lines; neither side ever locks or waits. When the
+ * consumer falls behind and the ring is full, the producer writes into a
+ * per-coin table instead (one seqlocked entry per coin, flagged in a dirty
+ * bitmap), so a slow consumer costs at most one entry per coin and gets
+ * each coin's latest update. Drain() delivers the flagged coins, then the
+ * ring, and skips anything older than what it already delivered for the
+ * coin, so each coin's updates arrive in order; no order holds across
+ * coins. A skipped update's fields are merged into the newer one of its
+ * coin, or that one is delivered again with them, so every moved field is
+ * reported at least once. Table entries accumulate their fields until the
+ * consumer takes them.
+ */
+class TickQueue {
+public:
+    /**
+     * @param catalog Coin list the slots refer to
+     * @param capacity Ring entries (rounded up to a power of two)
+     */
+    TickQueue(std::shared_ptr<const CoinCatalog> catalog, size_t capacity);
+
+    TickQueue(const TickQueue&) = delete;
+    TickQueue& operator=(const TickQueue&) = delete;
+
+    /**
+     * @brief Producer: hand in an update (never blocks; sets its sequence)
+     */
+    void Push(PriceUpdate update);
+
+    /**
+     * @brief Producer: no more updates for this coin list
+     */
+    void Close() { closed.store(true, std::memory_order_release); }
+
+    /**
+     * @brief Consumer: take everything pending
+     * @param out Cleared, then the updates (per coin oldest first)
+     * @return Number of updates delivered
+     */
+    size_t Drain(std::vector<PriceUpdate>& out);
+
+    /**
+     * @brief Whether the producer closed the queue (the coin list changed); drain, then resubscribe
+     */
+    bool Closed() const { return closed.load(std::memory_order_acquire); }
+
+    const CoinCatalog& Catalog() const { return *catalog; }
+    const std::shared_ptr<const CoinCatalog>& CatalogPtr() const { return catalog; }
+    size_t Capacity() const { return ring.size(); }
+
+    /**
+     * @brief Counters (approximate while both sides run)
+     */
+    TickQueueStats Stats() const;
+
+private:
+    static constexpr size_t CACHE_LINE = 64;
+
+    /**
+     * @brief Latest conflated update of one coin, guarded by a seqlock
+     */
+    struct Latest {
+        std::atomic<uint32_t> version{ 0 };     // Odd while the producer writes
+        std::atomic<uint64_t> sequence{ 0 };
+        std::atomic<int64_t> timestamp_ms{ 0 };
+        std::atomic<double> price{ 0.0 };
+        std::atomic<double> change_24h{ 0.0 };
+        std::atomic<uint8_t> fields{ 0 };       // Moved since the consumer last took them (outside the seqlock)
+    };
+
+    /**
+     * @brief Newest update delivered for one coin
+     */
+    struct Delivered {
+        PriceUpdate update;                     // Its values and sequence
+        size_t position = 0;                    // Its index in the output of the Drain() that delivered it
+    };
+
+    void Conflate(const PriceUpdate& update);
+
+    /**
+     * @brief Consumer: take a coin's accumulated fields and read its latest values
+     * @return false if the coin was never conflated
+     */
+    bool TakeLatest(uint32_t slot, PriceUpdate& update);
+
+    /**
+     * @brief Hand an update to 'out', or merge its fields into the newer update of its coin already there
+     */
+    void Deliver(const PriceUpdate& update, std::vector<PriceUpdate>& out);
+
+    std::shared_ptr<const CoinCatalog> catalog;
+    std::vector<PriceUpdate> ring;
+    size_t mask;
+    std::unique_ptr<Latest[]> latest;           // One per coin
+    std::unique_ptr<std::atomic<uint64_t>[]> dirty; // Bit per coin with a conflated update
+    size_t dirty_words;
+    std::atomic<bool> closed{ false };
+
+    // Producer side
+    alignas(CACHE_LINE) std::atomic<uint64_t> head{ 0 };    // Next ring position to write
+    uint64_t cached_tail = 0;                   // Consumer position last seen
+    uint64_t next_sequence = 1;
+    std::atomic<uint64_t> pushed{ 0 };
+    std::atomic<uint64_t> conflated{ 0 };
+    std::atomic<bool> conflated_pending{ false }; // Some dirty bit may be set
+
+    // Consumer side
+    alignas(CACHE_LINE) std::atomic<uint64_t> tail{ 0 };    // Next ring position to read
+    uint64_t cached_head = 0;                   // Producer position last seen
+    std::vector<Delivered> newest;              // Per coin
+    std::atomic<uint64_t> delivered{ 0 };
+    std::atomic<uint64_t> superseded{ 0 };
+};
@@ -0,0 +1,187 @@
+#include "TickerStreamParser.h"
+#include <json.hpp>
+#include <charconv>
+
+using json = nlohmann::json;
+
+namespace {
+
+/**
+ * @brief SAX handler for a ticker object or an array of ticker objects
+ */
+class TickerSaxHandler : public json::json_sax_t {
+public:
+    TickerSaxHandler(const TickerSymbolMap& symbols, std::string_view quote_asset,
+        std::vector<StagedQuote>& staging, std::vector<uint32_t>& dirty)
+        : symbols(symbols), quote_asset(quote_asset), staging(staging), dirty(dirty) {
+    }
+
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+    bool number_integer(number_integer_t val) override { return Number(static_cast<double>(val)); }
+    bool number_unsigned(number_unsigned_t val) override { return Number(static_cast<double>(val)); }
+    bool number_float(number_float_t val, const string_t&) override { return Number(val); }
+    bool binary(binary_t&) override { return true; }
+
+    bool string(string_t& val) override {
+        if (depth != ticker_depth) return true;
+
+        if (current_field == Field::Symbol) {
+            std::string_view symbol(val);
+            if (symbol.size() > quote_asset.size() && symbol.ends_with(quote_asset)) {
+                symbol.remove_suffix(quote_asset.size());
+                current_slot = symbols.Find(symbol);
+            }
+        }
+        else if (current_field == Field::Price || current_field == Field::Change) {
+            // Exchanges quote decimals as strings to keep their precision
+            double parsed = 0.0;
+            auto [end, ec] = std::from_chars(val.data(), val.data() + val.size(), parsed);
+            if (ec == std::errc()) {
+                Number(parsed);
+            }
+        }
+        return true;
+    }
+
+    bool start_object(std::size_t) override {
+        // The first value decides the shape: a single ticker or an array of them
+        if (depth == 0 && ticker_depth == 0) ticker_depth = 1;
+        ++depth;
+        if (depth == ticker_depth) {
+            current_slot = NO_SLOT;
+            has_price = has_change = false;
+        }
+        return true;
+    }
+
+    bool end_object() override {
+        if (depth == ticker_depth) {
+            Commit();
+        }
+        --depth;
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        if (depth == 0 && ticker_depth == 0) ticker_depth = 2;
+        ++depth;
+        return true;
+    }
+
+    bool end_array() override {
+        --depth;
+        return true;
+    }
+
+    bool key(string_t& val) override {
+        if (depth == ticker_depth && val.size() == 1) {
+            switch (val[0]) {
+            case 's': current_field = Field::Symbol; break;
+            case 'c': current_field = Field::Price; break;
+            case 'P': current_field = Field::Change; break;
+            case 'E': current_field = Field::EventTime; break;
+            default: current_field = Field::Other; break;
+            }
+        }
+        else if (depth == ticker_depth) {
+            current_field = Field::Other;
+        }
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+        error = ex.what();
+        return false;
+    }
+
+    size_t tickers = 0;
+    size_t unknown = 0;
+    int64_t newest_event_ms = 0;
+    std::string error;
+
+private:
+    enum class Field { Other, Symbol, Price, Change, EventTime };
+    static constexpr size_t NO_SLOT = CoinIndex::NOT_FOUND;
+
+    bool Number(double val) {
+        if (depth != ticker_depth) return true;
+
+        switch (current_field) {
+        case Field::Price:
+            price = val;
+            has_price = true;
+            break;
+        case Field::Change:
+            change = val;
+            has_change = true;
+            break;
+        case Field::EventTime:
+            if (static_cast<int64_t>(val) > newest_event_ms) newest_event_ms = static_cast<int64_t>(val);
+            break;
+        default:
+            break;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Write the finished ticker object into its slot
+     */
+    void Commit() {
+        if (current_slot == NO_SLOT || current_slot >= staging.size()) {
+            ++unknown;
+            return;
+        }
+        if (!has_price && !has_change) return;
+
+        StagedQuote& quote = staging[current_slot];
+        if (quote.fields == 0) {
+            dirty.push_back(static_cast<uint32_t>(current_slot));
+        }
+        if (has_price) {
+            quote.price = price;
+            quote.fields |= StagedQuote::HAS_PRICE;
+        }
+        if (has_change) {
+            quote.change_24h = change;
+            quote.fields |= StagedQuote::HAS_CHANGE;
+        }
+        ++tickers;
+    }
+
+    const TickerSymbolMap& symbols;
+    std::string_view quote_asset;
+    std::vector<StagedQuote>& staging;
+    std::vector<uint32_t>& dirty;
+    int depth = 0;
+    int ticker_depth = 0;                   // 1 for a single ticker, 2 inside an array
+    Field current_field = Field::Other;
+    size_t current_slot = NO_SLOT;          // Slot of the ticker being parsed ("s" may come last)
+    double price = 0.0;
+    double change = 0.0;
+    bool has_price = false;
+    bool has_change = false;
+};
+
+} // namespace
+
+TickerSymbolMap::TickerSymbolMap(const CoinCatalog& catalog, const std::unordered_map<std::string, std::string>& pins)
+    : index(&catalog.Index()) {
+    for (const auto& [symbol, id] : pins) {
+        pinned.emplace(symbol, index->FindById(id));
+    }
+}
+
+TickerParseResult TickerStreamParser::Parse(std::string_view message, const TickerSymbolMap& symbols,
+    std::string_view quote_asset, std::vector<StagedQuote>& staging, std::vector<uint32_t>& dirty) {
+    TickerSaxHandler handler(symbols, quote_asset, staging, dirty);
+
+    TickerParseResult result;
+    result.ok = json::sax_parse(message.begin(), message.end(), &handler);
+    result.tickers = handler.tickers;
+    result.unknown = handler.unknown;
+    result.newest_event_ms = handler.newest_event_ms;
+    result.error = std::move(handler.error);
+    return result;
+}
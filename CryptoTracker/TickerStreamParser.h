@@ -0,0 +1,90 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+#include "CoinCatalog.h"
+#include "CoinIndex.h"
+#include "PriceResponseParser.h"
+
+/**
+ * @brief Outcome of parsing one ticker stream message
+ */
+struct TickerParseResult {
+    bool ok = false;                // Whole message parsed
+    size_t tickers = 0;             // Ticker objects for known coins
+    size_t unknown = 0;             // Ticker objects whose symbol is not tracked
+    int64_t newest_event_ms = 0;    // Largest "E" (event time, ms since epoch), 0 if absent
+    std::string error;              // Parser message when !ok
+};
+
+/**
+ * @brief Exchange base symbol -> slot of a coin list
+ *
+ * Pinned symbols (base symbol -> CoinGecko ID) map to their coin, or to no
+ * coin if it is not in the list; the others resolve through
+ * CoinIndex::FindBySymbol, which skips symbols several coins share. Pins
+ * are how a shared symbol (many tokens call themselves "BTC" in the full
+ * CoinGecko list) still reaches the right coin.
+ */
+class TickerSymbolMap {
+public:
+    /**
+     * @param catalog Coin list the slots refer to (must outlive the map)
+     * @param pins Base symbol -> CoinGecko ID
+     */
+    explicit TickerSymbolMap(const CoinCatalog& catalog,
+        const std::unordered_map<std::string, std::string>& pins = {});
+
+    /**
+     * @return Slot of the coin trading as 'symbol', or CoinIndex::NOT_FOUND
+     */
+    size_t Find(std::string_view symbol) const {
+        if (!pinned.empty()) {
+            auto it = pinned.find(symbol);
+            if (it != pinned.end()) return it->second;
+        }
+        return index->FindBySymbol(symbol);
+    }
+
+private:
+    struct Hash {
+        using is_transparent = void;
+        size_t operator()(std::string_view text) const { return std::hash<std::string_view>()(text); }
+    };
+
+    const CoinIndex* index;
+    std::unordered_map<std::string, size_t, Hash, std::equal_to<>> pinned;  // Symbol -> slot or NOT_FOUND
+};
+
+/**
+ * @brief Parser for exchange 24h ticker stream messages (Binance format)
+ *
+ * A message is one ticker object or an array of them, e.g.
+ * {"e":"24hrTicker","E":1700000000000,"s":"BTCUSDT","c":"43250.10","P":"-1.25",...}.
+ * "s" minus the quote asset suffix is resolved with a TickerSymbolMap;
+ * "c" (last price) and "P" (24h change in percent) may be strings or numbers.
+ * Uses the nlohmann::json SAX interface like PriceResponseParser, so no
+ * DOM is built and a message allocates nothing once the parser's token
+ * buffer has grown.
+ *
+ * Results accumulate across messages: a slot's StagedQuote is overwritten
+ * by newer tickers, and a slot is appended to 'dirty' the first time it
+ * receives a field (its 'fields' were 0). The caller applies the dirty
+ * slots as one batch and then resets their 'fields' and clears 'dirty'.
+ */
+class TickerStreamParser {
+public:
+    /**
+     * @brief Parse one message into the pending batch
+     * @param message Complete WebSocket message
+     * @param symbols Base symbol -> slot lookup
+     * @param quote_asset Symbol suffix of the tracked market (e.g., "USDT"); others are skipped
+     * @param staging One entry per slot
+     * @param dirty Slots with pending fields, in order of first update
+     */
+    static TickerParseResult Parse(std::string_view message, const TickerSymbolMap& symbols,
+        std::string_view quote_asset, std::vector<StagedQuote>& staging, std::vector<uint32_t>& dirty);
+};
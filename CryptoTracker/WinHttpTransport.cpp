@@ -0,0 +1,398 @@
+#ifdef _WIN32
+#include "WinHttpTransport.h"
+#include <windows.h>
+#include <winhttp.h>
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <thread>
+
+#pragma comment(lib, "winhttp.lib")
+
+namespace {
+
+/**
+ * @brief BodyStream over an open WinHTTP request handle
+ */
+class WinHttpBodyStream : public BodyStream {
+public:
+    WinHttpBodyStream(HINTERNET hRequest, ResponseBuffer& body)
+        : hRequest(hRequest), body(body) {
+        DWORD dwStatus = 0;
+        DWORD dwStatusSize = sizeof(dwStatus);
+        if (WinHttpQueryHeaders(hRequest,
+            WINHTTP_QUERY_STATUS_CODE | WINHTTP_QUERY_FLAG_NUMBER,
+            WINHTTP_HEADER_NAME_BY_INDEX, &dwStatus, &dwStatusSize,
+            WINHTTP_NO_HEADER_INDEX)) {
+            status = static_cast<int>(dwStatus);
+        }
+
+        // Raw header block, narrowed for FindHttpHeader (header values are ASCII)
+        DWORD dwSize = 0;
+        WinHttpQueryHeaders(hRequest, WINHTTP_QUERY_RAW_HEADERS_CRLF,
+            WINHTTP_HEADER_NAME_BY_INDEX, WINHTTP_NO_OUTPUT_BUFFER, &dwSize, WINHTTP_NO_HEADER_INDEX);
+        if (GetLastError() == ERROR_INSUFFICIENT_BUFFER && dwSize > 0) {
+            std::wstring raw(dwSize / sizeof(wchar_t), L'\0');
+            if (WinHttpQueryHeaders(hRequest, WINHTTP_QUERY_RAW_HEADERS_CRLF,
+                WINHTTP_HEADER_NAME_BY_INDEX, &raw[0], &dwSize, WINHTTP_NO_HEADER_INDEX)) {
+                raw.resize(dwSize / sizeof(wchar_t));
+                head.reserve(raw.size());
+                for (wchar_t c : raw) {
+                    head += static_cast<char>(c < 0x80 ? c : '?');
+                }
+            }
+        }
+    }
+
+    std::string_view Next() override {
+        if (done) return {};
+
+        DWORD dwSize = 0;
+        DWORD dwDownloaded = 0;
+
+        if (!WinHttpQueryDataAvailable(hRequest, &dwSize)) {
+            failed = true;
+            done = true;
+            return {};
+        }
+        if (dwSize == 0) {
+            done = true;
+            return {};
+        }
+
+        // Read straight into the reusable buffer - no per-chunk allocation
+        size_t offset = body.Size();
+        if (!WinHttpReadData(hRequest, (LPVOID)body.PrepareWrite(dwSize),
+            dwSize, &dwDownloaded)) {
+            failed = true;
+            done = true;
+            return {};
+        }
+        body.CommitWrite(dwDownloaded);
+
+        return body.View().substr(offset);
+    }
+
+    /**
+     * @brief Read whatever the consumer left unread
+     */
+    void Drain() {
+        while (!done) {
+            Next();
+        }
+    }
+
+    bool Failed() const { return failed; }
+
+    int Status() const override { return status; }
+
+    std::string_view Header(std::string_view name) const override {
+        return FindHttpHeader(head, name);
+    }
+
+private:
+    HINTERNET hRequest;
+    ResponseBuffer& body;
+    std::string head;               // Status line and headers
+    int status = 0;
+    bool done = false;
+    bool failed = false;
+};
+
+/**
+ * @brief WebSocket over a WinHTTP WebSocket handle
+ *
+ * WinHttpWebSocketReceive has no timeout, so a reader thread assembles
+ * messages into a queue and Receive() waits on it. WinHTTP answers pings
+ * itself.
+ */
+class WinHttpWebSocket : public WebSocket {
+public:
+    WinHttpWebSocket(HINTERNET hWebSocket, std::function<bool()> untrack)
+        : hWebSocket(hWebSocket), untrack(std::move(untrack)) {
+        reader = std::thread(&WinHttpWebSocket::ReadLoop, this);
+    }
+
+    ~WinHttpWebSocket() override {
+        // Closing the handle aborts the reader's pending receive
+        // (unless CancelAll() already closed it)
+        if (untrack()) {
+            WinHttpWebSocketShutdown(hWebSocket, WINHTTP_WEB_SOCKET_SUCCESS_CLOSE_STATUS, NULL, 0);
+            WinHttpCloseHandle(hWebSocket);
+        }
+        reader.join();
+    }
+
+    bool SendText(std::string_view text) override {
+        return WinHttpWebSocketSend(hWebSocket, WINHTTP_WEB_SOCKET_UTF8_MESSAGE_BUFFER_TYPE,
+            (PVOID)text.data(), static_cast<DWORD>(text.size())) == NO_ERROR;
+    }
+
+    Status Receive(ResponseBuffer& message, std::chrono::milliseconds timeout) override {
+        message.Clear();
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        if (!queue_cv.wait_for(lock, timeout, [&] { return !messages.empty() || closed; })) {
+            return Status::Timeout;
+        }
+        if (messages.empty()) return Status::Closed;
+
+        const std::string& next = messages.front();
+        std::memcpy(message.PrepareWrite(next.size()), next.data(), next.size());
+        message.CommitWrite(next.size());
+        messages.pop_front();
+        return Status::Message;
+    }
+
+private:
+    void ReadLoop() {
+        std::string assembling;
+        char chunk[16384];
+        for (;;) {
+            DWORD read = 0;
+            WINHTTP_WEB_SOCKET_BUFFER_TYPE type;
+            if (WinHttpWebSocketReceive(hWebSocket, chunk, sizeof(chunk), &read, &type) != NO_ERROR ||
+                type == WINHTTP_WEB_SOCKET_CLOSE_BUFFER_TYPE) {
+                break;
+            }
+            assembling.append(chunk, read);
+            if (type == WINHTTP_WEB_SOCKET_UTF8_MESSAGE_BUFFER_TYPE ||
+                type == WINHTTP_WEB_SOCKET_BINARY_MESSAGE_BUFFER_TYPE) {
+                std::lock_guard<std::mutex> lock(queue_mutex);
+                messages.push_back(std::move(assembling));
+                assembling.clear();
+                queue_cv.notify_one();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        closed = true;
+        queue_cv.notify_all();
+    }
+
+    HINTERNET hWebSocket;
+    std::function<bool()> untrack;      // Unregisters the handle; false if CancelAll() closed it
+    std::thread reader;
+    std::mutex queue_mutex;             // Guards messages and closed
+    std::condition_variable queue_cv;
+    std::deque<std::string> messages;   // Complete messages not yet received
+    bool closed = false;                // Reader finished
+};
+
+} // namespace
+
+WinHttpTransport::WinHttpTransport() {
+    session = WinHttpOpen(L"CryptoTracker/1.0",
+        WINHTTP_ACCESS_TYPE_DEFAULT_PROXY,
+        WINHTTP_NO_PROXY_NAME,
+        WINHTTP_NO_PROXY_BYPASS, 0);
+}
+
+WinHttpTransport::~WinHttpTransport() {
+    for (auto& entry : connections) {
+        WinHttpCloseHandle(entry.second);
+    }
+    if (session) {
+        WinHttpCloseHandle(session);
+    }
+}
+
+void* WinHttpTransport::AcquireConnection(const HttpEndpoint& endpoint) {
+    std::wstring server(endpoint.host.begin(), endpoint.host.end());
+    std::wstring key = server + L":" + std::to_wstring(endpoint.port);
+
+    std::lock_guard<std::mutex> lock(connections_mutex);
+
+    auto it = connections.find(key);
+    if (it != connections.end()) {
+        return it->second;
+    }
+
+    HINTERNET hConnect = WinHttpConnect(session, server.c_str(), endpoint.port, 0);
+    if (!hConnect) return nullptr;
+
+    connections[key] = hConnect;
+    return hConnect;
+}
+
+bool WinHttpTransport::TrackActive(void* request, uint64_t generation) {
+    std::lock_guard<std::mutex> lock(active_mutex);
+    if (generation != cancel_generation) return false;
+    active_requests.push_back(request);
+    return true;
+}
+
+bool WinHttpTransport::UntrackActive(void* request) {
+    std::lock_guard<std::mutex> lock(active_mutex);
+    auto it = std::find(active_requests.begin(), active_requests.end(), request);
+    if (it == active_requests.end()) return false;
+    *it = active_requests.back();
+    active_requests.pop_back();
+    return true;
+}
+
+void WinHttpTransport::CancelAll() {
+    std::lock_guard<std::mutex> lock(active_mutex);
+    ++cancel_generation;
+
+    // Closing a request handle aborts the synchronous call blocked on it
+    for (void* request : active_requests) {
+        WinHttpCloseHandle(request);
+    }
+    active_requests.clear();
+}
+
+bool WinHttpTransport::GetStreaming(const HttpEndpoint& endpoint, const std::string& path,
+    ResponseBuffer& body, const BodyConsumer& consume) {
+    body.Clear();
+    requests.fetch_add(1);
+
+    if (!session) return false;
+
+    uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lock(active_mutex);
+        generation = cancel_generation;
+    }
+
+    // Connect handles are shared; WinHTTP allows concurrent requests on them
+    HINTERNET hConnect = AcquireConnection(endpoint);
+    if (!hConnect) return false;
+
+    std::wstring wpath(path.begin(), path.end());
+    HINTERNET hRequest = WinHttpOpenRequest(hConnect, L"GET", wpath.c_str(),
+        NULL, WINHTTP_NO_REFERER,
+        WINHTTP_DEFAULT_ACCEPT_TYPES,
+        endpoint.secure ? WINHTTP_FLAG_SECURE : 0);
+
+    if (!hRequest) return false;
+    if (!TrackActive(hRequest, generation)) {
+        WinHttpCloseHandle(hRequest);
+        return false;
+    }
+
+    BOOL bResults = WinHttpSendRequest(hRequest,
+        WINHTTP_NO_ADDITIONAL_HEADERS, 0,
+        WINHTTP_NO_REQUEST_DATA, 0,
+        0, 0);
+
+    if (bResults) {
+        bResults = WinHttpReceiveResponse(hRequest, NULL);
+    }
+
+    if (bResults) {
+        CountConnection(hRequest);
+
+        // Reserve the whole body up front when the server announces its size
+        DWORD dwContentLength = 0;
+        DWORD dwLengthSize = sizeof(dwContentLength);
+        if (WinHttpQueryHeaders(hRequest,
+            WINHTTP_QUERY_CONTENT_LENGTH | WINHTTP_QUERY_FLAG_NUMBER,
+            WINHTTP_HEADER_NAME_BY_INDEX, &dwContentLength, &dwLengthSize,
+            WINHTTP_NO_HEADER_INDEX)) {
+            body.PrepareWrite(dwContentLength);
+        }
+
+        WinHttpBodyStream stream(hRequest, body);
+        consume(stream);
+        stream.Drain();
+        bResults = stream.Failed() ? FALSE : TRUE;
+    }
+
+    // Closing the request returns the socket to the session's keep-alive pool
+    // (unless CancelAll() already closed it)
+    if (UntrackActive(hRequest)) {
+        WinHttpCloseHandle(hRequest);
+    }
+    else {
+        bResults = FALSE;
+    }
+
+    return bResults == TRUE;
+}
+
+std::unique_ptr<WebSocket> WinHttpTransport::OpenWebSocket(const HttpEndpoint& endpoint, const std::string& path) {
+    requests.fetch_add(1);
+    if (!session) return nullptr;
+
+    uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lock(active_mutex);
+        generation = cancel_generation;
+    }
+
+    HINTERNET hConnect = AcquireConnection(endpoint);
+    if (!hConnect) return nullptr;
+
+    std::wstring wpath(path.begin(), path.end());
+    HINTERNET hRequest = WinHttpOpenRequest(hConnect, L"GET", wpath.c_str(),
+        NULL, WINHTTP_NO_REFERER,
+        WINHTTP_DEFAULT_ACCEPT_TYPES,
+        endpoint.secure ? WINHTTP_FLAG_SECURE : 0);
+    if (!hRequest) return nullptr;
+    if (!TrackActive(hRequest, generation)) {
+        WinHttpCloseHandle(hRequest);
+        return nullptr;
+    }
+
+    BOOL bResults = WinHttpSetOption(hRequest, WINHTTP_OPTION_UPGRADE_TO_WEB_SOCKET, NULL, 0);
+    if (bResults) {
+        bResults = WinHttpSendRequest(hRequest,
+            WINHTTP_NO_ADDITIONAL_HEADERS, 0,
+            WINHTTP_NO_REQUEST_DATA, 0,
+            0, 0);
+    }
+    if (bResults) {
+        bResults = WinHttpReceiveResponse(hRequest, NULL);
+    }
+
+    if (bResults) {
+        CountConnection(hRequest);
+    }
+    HINTERNET hWebSocket = bResults ? WinHttpWebSocketCompleteUpgrade(hRequest, 0) : NULL;
+
+    // The request handle is not needed once upgraded
+    if (UntrackActive(hRequest)) {
+        WinHttpCloseHandle(hRequest);
+    }
+    else if (hWebSocket) {
+        WinHttpCloseHandle(hWebSocket);     // Cancelled during the handshake
+        hWebSocket = NULL;
+    }
+    if (!hWebSocket) return nullptr;
+
+    if (!TrackActive(hWebSocket, generation)) {
+        WinHttpCloseHandle(hWebSocket);
+        return nullptr;
+    }
+    return std::make_unique<WinHttpWebSocket>(hWebSocket, [this, hWebSocket] { return UntrackActive(hWebSocket); });
+}
+
+void WinHttpTransport::CountConnection(void* request) {
+    // Zeroed, so the address bytes past the family's sockaddr are equal across calls
+    WINHTTP_CONNECTION_INFO info;
+    std::memset(&info, 0, sizeof(info));
+    info.cbSize = sizeof(info);
+    DWORD size = sizeof(info);
+    if (!WinHttpQueryOption(request, WINHTTP_OPTION_CONNECTION_INFO, &info, &size)) {
+        return;
+    }
+
+    std::string key(reinterpret_cast<const char*>(&info.LocalAddress), sizeof(info.LocalAddress));
+    bool added;
+    {
+        std::lock_guard<std::mutex> lock(sockets_mutex);
+        added = seen_sockets.insert(std::move(key)).second;
+    }
+    (added ? connections_opened : connections_reused).fetch_add(1);
+}
+
+TransportStats WinHttpTransport::GetStats() const {
+    TransportStats stats;
+    stats.requests = requests.load();
+    stats.connections_opened = connections_opened.load();
+    stats.connections_reused = connections_reused.load();
+    return stats;
+}
+
+#endif // _WIN32
@@ -0,0 +1,71 @@
+#pragma once
+#include "HttpTransport.h"
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <atomic>
+
+/**
+ * @brief HttpTransport implementation backed by WinHTTP (Windows only)
+ *
+ * Keeps one WinHTTP session for the lifetime of the object plus one
+ * connect handle per host:port. WinHTTP pools the underlying keep-alive
+ * sockets per session, so only the first request to a host pays for
+ * DNS and the TCP/TLS handshake; each response's socket is looked up
+ * (WINHTTP_OPTION_CONNECTION_INFO) to count that reuse. Open request and
+ * WebSocket handles are tracked so CancelAll() can close them, which
+ * aborts the blocked WinHTTP call.
+ */
+class WinHttpTransport : public HttpTransport {
+public:
+    WinHttpTransport();
+    ~WinHttpTransport() override;
+
+    bool GetStreaming(const HttpEndpoint& endpoint, const std::string& path,
+        ResponseBuffer& body, const BodyConsumer& consume) override;
+    std::unique_ptr<WebSocket> OpenWebSocket(const HttpEndpoint& endpoint, const std::string& path) override;
+    void CancelAll() override;
+    TransportStats GetStats() const override;
+
+private:
+    /**
+     * @brief Get (or create) the connect handle for an endpoint
+     * @return Connect handle, or nullptr on failure
+     */
+    void* AcquireConnection(const HttpEndpoint& endpoint);
+
+    /**
+     * @brief Register an open request handle
+     * @param generation cancel_generation when the request started
+     * @return false if CancelAll() ran since then (the request must abort)
+     */
+    bool TrackActive(void* request, uint64_t generation);
+
+    /**
+     * @brief Unregister a request handle
+     * @return false if CancelAll() already closed it
+     */
+    bool UntrackActive(void* request);
+
+    /**
+     * @brief Count the socket a sent request went out on as opened or reused
+     *
+     * Sockets are keyed by local address and port, so a new socket that
+     * happens to get the port of a closed one counts as reused.
+     */
+    void CountConnection(void* request);
+
+    void* session = nullptr;                    // HINTERNET session handle
+    std::mutex connections_mutex;               // Protects connections map
+    std::map<std::wstring, void*> connections;  // "host:port" -> HINTERNET connect handle
+    std::mutex active_mutex;                    // Protects active_requests and cancel_generation
+    std::vector<void*> active_requests;         // HINTERNET request/WebSocket handles in flight
+    uint64_t cancel_generation = 0;             // Bumped by every CancelAll()
+    std::atomic<uint64_t> requests{ 0 };
+    std::mutex sockets_mutex;                   // Protects seen_sockets
+    std::unordered_set<std::string> seen_sockets; // Local addresses of sockets requests went out on
+    std::atomic<uint64_t> connections_opened{ 0 };
+    std::atomic<uint64_t> connections_reused{ 0 };
+};
@@ -0,0 +1,248 @@
+#include "AlertEngine.h"
+#include "PriceManager.h"
+#include "PosixHttpTransport.h"
+#include "MockPriceServer.h"
+#include "PriceResponseParser.h"
+#include "BenchUtil.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Price alert evaluation benchmark
+ *
+ * Evaluates 10k alerts against random-walk price ticks with the
+ * AlertEngine (sorted levels per coin, binary search between the old and
+ * new price) and with a per-coin linear scan that checks every alert of
+ * the coin, with the alerts spread over 1000 or 100 coins or all on one
+ * coin. Both must trigger the same alerts. Then counts triggers of a
+ * price hovering around a threshold with and without hysteresis, and runs
+ * 10k alerts end to end through PriceManager against a MockPriceServer:
+ * time from a fetch's publication until its updates are evaluated.
+ */
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+constexpr size_t COINS = 15000;
+constexpr size_t ALERTS = 10000;
+constexpr size_t MOVED = 3000;                  // Coins moving per tick
+constexpr int TICKS = 500;
+
+double UsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Baseline: every alert of the coin checked on every update
+ */
+class LinearAlerts {
+public:
+    explicit LinearAlerts(size_t coins) : by_coin(coins), last(coins, -1.0) {}
+
+    void Add(uint32_t slot, bool above, double threshold, double hysteresis) {
+        double band = hysteresis * threshold;
+        by_coin[slot].push_back({ threshold, above ? threshold - band : threshold + band, above, false });
+    }
+
+    size_t Evaluate(uint32_t slot, double value) {
+        size_t fired = 0;
+        bool first = last[slot] < 0.0;
+        last[slot] = value;
+        for (Alert& alert : by_coin[slot]) {
+            bool met = alert.above ? value >= alert.threshold : value <= alert.threshold;
+            if (first) {
+                alert.armed = !met;
+            }
+            else if (alert.armed && met) {
+                alert.armed = false;
+                ++fired;
+            }
+            else if (!alert.armed && (alert.above ? value < alert.rearm : value > alert.rearm)) {
+                alert.armed = true;
+            }
+        }
+        return fired;
+    }
+
+private:
+    struct Alert {
+        double threshold;
+        double rearm;
+        bool above;
+        bool armed;
+    };
+    std::vector<std::vector<Alert>> by_coin;
+    std::vector<double> last;
+};
+
+/**
+ * @brief Random-walk ticks over the coins that carry alerts
+ */
+std::vector<std::vector<PriceUpdate>> MakeTicks(const std::vector<uint32_t>& coins, size_t moved, std::mt19937& rng) {
+    std::uniform_int_distribution<size_t> pick(0, coins.size() - 1);
+    std::normal_distribution<double> step(0.0, 0.01);
+    std::vector<double> price(COINS, 100.0);
+    std::vector<std::vector<PriceUpdate>> ticks(TICKS);
+    for (int t = 0; t < TICKS; ++t) {
+        for (size_t m = 0; m < moved; ++m) {
+            uint32_t slot = coins[pick(rng)];
+            price[slot] *= 1.0 + step(rng);
+            PriceUpdate update;
+            update.timestamp_ms = t;
+            update.price = price[slot];
+            update.slot = slot;
+            update.fields = StagedQuote::HAS_PRICE;
+            ticks[t].push_back(update);
+        }
+    }
+    return ticks;
+}
+
+void RunSpread(const char* label, const std::shared_ptr<const CoinCatalog>& catalog, size_t alert_coins, size_t moved) {
+    std::mt19937 rng(11);
+    std::vector<uint32_t> coins(alert_coins);
+    for (size_t i = 0; i < alert_coins; ++i) coins[i] = static_cast<uint32_t>(i * (COINS / alert_coins));
+
+    // Thresholds within +-20% of the starting price, half above, half below
+    AlertPolicy policy;
+    AlertEngine engine(policy);
+    engine.Bind(catalog);
+    LinearAlerts linear(COINS);
+    std::uniform_real_distribution<double> level(80.0, 120.0);
+    for (size_t a = 0; a < ALERTS; ++a) {
+        AlertRule rule;
+        uint32_t slot = coins[a % alert_coins];
+        rule.coin_id = std::string(catalog->Id(slot));
+        rule.direction = a % 2 ? AlertDirection::Below : AlertDirection::Above;
+        rule.threshold = level(rng);
+        engine.Add(rule);
+        linear.Add(slot, rule.direction == AlertDirection::Above, rule.threshold, policy.price_hysteresis);
+    }
+
+    std::vector<std::vector<PriceUpdate>> ticks = MakeTicks(coins, moved, rng);
+    size_t indexed_fired = 0, linear_fired = 0;
+    double indexed_us = 0.0, linear_us = 0.0, indexed_max_us = 0.0;
+    for (const auto& tick : ticks) {
+        auto start = Clock::now();
+        for (const PriceUpdate& update : tick) indexed_fired += engine.Evaluate(update);
+        double us = UsSince(start);
+        indexed_us += us;
+        indexed_max_us = std::max(indexed_max_us, us);
+
+        start = Clock::now();
+        for (const PriceUpdate& update : tick) linear_fired += linear.Evaluate(update.slot, update.price);
+        linear_us += UsSince(start);
+    }
+
+    AlertStats stats = engine.Stats();
+    double updates = static_cast<double>(TICKS * moved);
+    std::printf("%-26s %7zu %10.1f %10.1f %10.1f %12.1f %12.1f %9.2f %8zu %6s\n", label, moved,
+        indexed_us / TICKS, indexed_max_us, linear_us / TICKS, indexed_us * 1000.0 / updates,
+        linear_us * 1000.0 / updates, static_cast<double>(stats.levels_visited) / updates, indexed_fired,
+        indexed_fired == linear_fired ? "yes" : "NO");
+}
+
+void RunFlapping(const std::shared_ptr<const CoinCatalog>& catalog, double hysteresis) {
+    AlertEngine engine;
+    engine.Bind(catalog);
+    AlertRule rule;
+    rule.coin_id = std::string(catalog->Id(0));
+    rule.threshold = 100.0;
+    rule.hysteresis = hysteresis;
+    engine.Add(rule);
+
+    // Hovers within +-0.2% of the threshold for 1000 ticks
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> noise(-0.002, 0.002);
+    PriceUpdate update;
+    update.fields = StagedQuote::HAS_PRICE;
+    size_t fired = 0;
+    for (int t = 0; t < 1000; ++t) {
+        update.price = 100.0 * (1.0 + noise(rng));
+        update.timestamp_ms = t;
+        fired += engine.Evaluate(update);
+    }
+    std::printf("  hysteresis %.2f%%: %zu triggers in 1000 ticks\n", hysteresis * 100.0, fired);
+}
+
+void RunEndToEnd(uint16_t port) {
+    PriceManagerConfig config;
+    config.api_endpoint = HttpEndpoint{ "127.0.0.1", port };
+    config.start_update_thread = false;
+    config.persist_watchlist = false;
+    config.persist_ticks = false;
+    config.log_to_console = false;
+
+    PriceManager manager(std::make_unique<PosixHttpTransport>(), config);
+    std::vector<CoinInfo> universe = MakeUniverse(COINS);
+    manager.SetTrackedCoins(universe);
+    manager.UpdatePrices().get();
+
+    // Thresholds within +-2% of each coin's current price
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> offset(-0.02, 0.02);
+    std::uniform_int_distribution<size_t> pick(0, COINS - 1);
+    std::shared_ptr<const CoinSnapshot> snapshot = manager.GetSnapshot();
+    for (size_t a = 0; a < ALERTS; ++a) {
+        size_t slot = pick(rng);
+        AlertRule rule;
+        rule.coin_id = universe[slot].id;
+        rule.direction = a % 2 ? AlertDirection::Below : AlertDirection::Above;
+        rule.threshold = snapshot->store.Price(slot) * (1.0 + offset(rng));
+        manager.AddAlert(rule);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));   // Alert thread subscribes
+
+    constexpr int ROUNDS = 10;
+    double lag_us = 0.0, max_lag_us = 0.0;
+    for (int r = 0; r < ROUNDS; ++r) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(250));
+        uint64_t before = manager.GetAlertStats().updates;
+        manager.UpdatePrices().get();
+        auto published = Clock::now();
+        uint64_t expected = before + manager.GetLastFetchStats().coins_changed;
+        while (manager.GetAlertStats().updates < expected) {
+            std::this_thread::yield();
+        }
+        double us = UsSince(published);
+        lag_us += us;
+        max_lag_us = std::max(max_lag_us, us);
+    }
+    AlertStats stats = manager.GetAlertStats();
+    std::printf("\nEnd to end (%zu coins, %zu alerts, %d fetches): publication to evaluated avg %.0f us, "
+        "max %.0f us; %llu updates, %llu triggers, %zu armed\n", COINS, ALERTS, ROUNDS, lag_us / ROUNDS,
+        max_lag_us, static_cast<unsigned long long>(stats.updates),
+        static_cast<unsigned long long>(stats.triggered), stats.armed);
+}
+
+} // namespace
+
+int main() {
+    auto catalog = std::make_shared<const CoinCatalog>(MakeUniverse(COINS));
+
+    std::printf("Alert evaluation (%zu alerts, %d ticks of random-walk prices, 1%% moves)\n\n", ALERTS, TICKS);
+    std::printf("%-26s %7s %10s %10s %10s %12s %12s %9s %8s %6s\n", "alerts on", "updates", "tick_us",
+        "tick_max", "linear_us", "ns/update", "linear_ns", "visited", "fired", "same");
+    RunSpread("1000 coins (10 each)", catalog, 1000, MOVED);
+    RunSpread("100 coins (100 each)", catalog, 100, 100);
+    RunSpread("1 coin (10000)", catalog, 1, 1);
+
+    std::printf("\nPrice hovering at a threshold\n");
+    RunFlapping(catalog, 0.0);
+    RunFlapping(catalog, 0.005);
+
+    MockPriceServer server;
+    uint16_t port = server.Start();
+    if (port == 0) {
+        std::fprintf(stderr, "Failed to start mock server\n");
+        return 1;
+    }
+    RunEndToEnd(port);
+    server.Stop();
+    return 0;
+}
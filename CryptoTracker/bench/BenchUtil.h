@@ -0,0 +1,21 @@
+#pragma once
+#include <cstdio>
+#include <vector>
+#include "Coin.h"
+
+/**
+ * @brief Build a synthetic coin universe ("coin-00000", "C0", "Coin 0", ...)
+ * @param count Number of coins
+ */
+inline std::vector<CoinInfo> MakeUniverse(size_t count) {
+    std::vector<CoinInfo> universe;
+    universe.reserve(count);
+    char id[32], symbol[24], name[32];      // Room for any size_t
+    for (size_t i = 0; i < count; ++i) {
+        std::snprintf(id, sizeof(id), "coin-%05zu", i);
+        std::snprintf(symbol, sizeof(symbol), "C%zu", i);
+        std::snprintf(name, sizeof(name), "Coin %zu", i);
+        universe.emplace_back(id, symbol, name);
+    }
+    return universe;
+}
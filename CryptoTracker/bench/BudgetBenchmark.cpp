@@ -0,0 +1,92 @@
+#include "PriceManager.h"
+#include "PosixHttpTransport.h"
+#include "MockPriceServer.h"
+#include "BenchUtil.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+/**
+ * @brief Request budget benchmark
+ *
+ * Polls a rate-limited MockPriceServer (fixed window, 429 + Retry-After
+ * beyond it) with the background scheduler for a universe that needs more
+ * requests per refresh than the limit allows. Compares reacting to 429s
+ * alone, following the server's X-RateLimit headers, and pacing with a
+ * local token bucket matched to the limit: requests sent, held back
+ * locally and rejected by the server, batches refreshed per second and the
+ * age of the oldest price.
+ */
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+constexpr size_t COINS = 15000;
+constexpr size_t LIMIT = 20;                    // Requests per window on the server
+constexpr std::chrono::milliseconds WINDOW{ 1000 };
+constexpr std::chrono::seconds RUN{ 8 };
+
+void RunScenario(const char* label, MockPriceServer& server, uint16_t port, bool advertise, double per_minute) {
+    server.SetRateLimit(LIMIT, WINDOW, advertise);
+    uint64_t throttled_before = server.RequestsThrottled();
+
+    PriceManagerConfig config;
+    config.api_endpoint = HttpEndpoint{ "127.0.0.1", port };
+    config.persist_watchlist = false;
+    config.persist_ticks = false;
+    config.log_to_console = false;
+    config.update_interval = std::chrono::milliseconds(2000);
+    config.refresh.adaptive = false;            // Every coin each interval: the load the budget has to shape
+    config.api_budget.requests_per_minute = per_minute;
+    config.api_budget.burst = static_cast<double>(LIMIT);
+    config.api_budget.backoff_base = std::chrono::milliseconds(250);
+    PriceManager polling(std::make_unique<PosixHttpTransport>(), config);
+    polling.SetTrackedCoins(MakeUniverse(COINS));
+
+    // Sample the scheduler's fetches while it runs
+    double staleness_sum = 0.0, staleness_max = 0.0;
+    size_t samples = 0;
+    uint64_t version = polling.GetDataVersion();
+    auto start = Clock::now();
+    while (Clock::now() - start < RUN) {
+        if (!polling.WaitForDataChange(version, std::chrono::milliseconds(100))) continue;
+        version = polling.GetDataVersion();
+        FetchStats stats = polling.GetLastFetchStats();
+        if (Clock::now() - start > std::chrono::seconds(3)) {  // Past the initial backlog
+            staleness_sum += stats.max_staleness_ms;
+            staleness_max = std::max(staleness_max, stats.max_staleness_ms);
+            ++samples;
+        }
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    RequestBudgetStats budget = polling.GetProviderStats()[0].budget;
+    uint64_t throttled = server.RequestsThrottled() - throttled_before;
+    std::printf("%-30s %8llu %9llu %6llu %9llu %10.1f %12.0f %12.0f\n", label,
+        static_cast<unsigned long long>(budget.sent), static_cast<unsigned long long>(budget.rejected),
+        static_cast<unsigned long long>(throttled), static_cast<unsigned long long>(budget.backoffs),
+        (budget.sent - throttled) / seconds, samples ? staleness_sum / samples : 0.0, staleness_max);
+}
+
+} // namespace
+
+int main() {
+    MockPriceServer server;
+    uint16_t port = server.Start();
+    if (port == 0) {
+        std::fprintf(stderr, "Failed to start mock server\n");
+        return 1;
+    }
+
+    std::printf("Request budget (%zu coins, server allows %zu requests per %lld ms, poll interval 2 s, %lld s each)\n\n",
+        COINS, LIMIT, static_cast<long long>(WINDOW.count()), static_cast<long long>(RUN.count()));
+    std::printf("%-30s %8s %9s %6s %9s %10s %12s %12s\n", "client", "sent", "held_back", "429s", "backoffs",
+        "batches/s", "stale_avg_ms", "stale_max_ms");
+    RunScenario("429 + Retry-After only", server, port, false, 0.0);
+    RunScenario("X-RateLimit headers", server, port, true, 0.0);
+    RunScenario("token bucket at the limit", server, port, true, LIMIT * 60.0);
+
+    server.Stop();
+    return 0;
+}
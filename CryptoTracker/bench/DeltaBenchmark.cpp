@@ -0,0 +1,131 @@
+#include "PriceManager.h"
+#include "PosixHttpTransport.h"
+#include "MockPriceServer.h"
+#include "PriceFormat.h"
+#include "BenchUtil.h"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Change-set benchmark
+ *
+ * Refreshes 15k coins from a MockPriceServer whose prices follow the wave
+ * model (a few volatile coins, the rest barely moving) with increasing
+ * price epsilons. Reports per fetch how many coins moved, the data_mutex
+ * hold time and the history samples written, and compares a consumer that
+ * re-formats every coin per snapshot with one that applies the published
+ * change set.
+ */
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+constexpr size_t COINS = 15000;
+constexpr int ROUNDS = 20;
+constexpr std::chrono::milliseconds ROUND_GAP{ 250 };
+
+/**
+ * @brief Stand-in UI cache: formatted price text per coin
+ */
+struct TextCache {
+    std::vector<std::array<char, PriceFormat::PRICE_CHARS>> text;
+    uint64_t version = 0;
+
+    void Format(const CoinStore& store, size_t i) {
+        PriceFormat::FormatPrice(store.Price(i), text[i].data(), text[i].size());
+    }
+
+    void Full(const CoinSnapshot& snapshot) {
+        text.resize(snapshot.store.Size());
+        for (size_t i = 0; i < snapshot.store.Size(); ++i) Format(snapshot.store, i);
+        version = snapshot.version;
+    }
+
+    void Delta(const CoinSnapshot& snapshot) {
+        if (!snapshot.changes.AppliesTo(version) || text.size() != snapshot.store.Size()) {
+            Full(snapshot);
+            return;
+        }
+        for (uint32_t i : snapshot.changes.slots) Format(snapshot.store, i);
+        version = snapshot.version;
+    }
+};
+
+double UsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+void RunScenario(uint16_t port, double price_epsilon) {
+    PriceManagerConfig config;
+    config.api_endpoint = HttpEndpoint{ "127.0.0.1", port };
+    config.start_update_thread = false;
+    config.persist_watchlist = false;
+    config.persist_ticks = false;
+    config.log_to_console = false;
+    config.price_epsilon = price_epsilon;
+    config.change_epsilon = 0.005;              // Below the two decimals the table shows
+
+    PriceManager manager(std::make_unique<PosixHttpTransport>(), config);
+    manager.SetTrackedCoins(MakeUniverse(COINS));
+    manager.UpdatePrices().get();               // Every coin gets its first price
+
+    TextCache full, delta;
+    full.Full(*manager.GetSnapshot());
+    delta.Full(*manager.GetSnapshot());
+    auto appended = [&] {
+        std::shared_ptr<const PriceHistory> rings = manager.GetPriceHistory();
+        uint64_t total = 0;
+        for (size_t i = 0; i < COINS; ++i) total += rings->Appended(i);
+        return total;
+    };
+    uint64_t appended_before = appended();
+
+    double changed = 0.0, lock_us = 0.0, full_us = 0.0, delta_us = 0.0;
+    for (int r = 0; r < ROUNDS; ++r) {
+        std::this_thread::sleep_for(ROUND_GAP);
+        manager.UpdatePrices().get();
+        FetchStats stats = manager.GetLastFetchStats();
+        changed += static_cast<double>(stats.coins_changed);
+        lock_us += stats.lock_hold_us;
+
+        std::shared_ptr<const CoinSnapshot> snapshot = manager.GetSnapshot();
+        auto start = Clock::now();
+        full.Full(*snapshot);
+        full_us += UsSince(start);
+        start = Clock::now();
+        delta.Delta(*snapshot);
+        delta_us += UsSince(start);
+    }
+    double samples = static_cast<double>(appended() - appended_before);
+
+    std::printf("%10.0e %10.0f %8.1f%% %10.1f %12.0f %12.1f %12.1f\n", price_epsilon, changed / ROUNDS,
+        changed / ROUNDS / COINS * 100.0, lock_us / ROUNDS, samples / ROUNDS, full_us / ROUNDS, delta_us / ROUNDS);
+}
+
+} // namespace
+
+int main() {
+    MockPriceServer server;
+    uint16_t port = server.Start();
+    if (port == 0) {
+        std::fprintf(stderr, "Failed to start mock server\n");
+        return 1;
+    }
+    server.SetPriceWaves(0.05, 0.02, std::chrono::milliseconds(20000));
+
+    std::printf("Change sets (%zu coins, 5%% volatile, refresh every %lld ms, %d rounds; per-fetch averages)\n\n",
+        COINS, static_cast<long long>(ROUND_GAP.count()), ROUNDS);
+    std::printf("%10s %10s %9s %10s %12s %12s %12s\n", "epsilon", "changed", "share", "lock_us",
+        "history_adds", "full_pass_us", "delta_us");
+    RunScenario(port, 0.0);
+    RunScenario(port, 1e-5);
+    RunScenario(port, 1e-4);
+    RunScenario(port, 1e-3);
+
+    server.Stop();
+    return 0;
+}
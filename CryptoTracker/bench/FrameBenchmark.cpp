@@ -0,0 +1,135 @@
+#include "CryptoUI.h"
+#include "BenchUtil.h"
+#include "HeadlessImGui.h"
+#include <imgui.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+/**
+ * @brief Headless UI frame benchmark
+ *
+ * Drives CryptoUI::Render() against an ImGui context with no platform or
+ * renderer backend and reports CPU time and vertex count per frame for
+ * growing coin universes. With the all-coins table clipped to its visible
+ * rows both should stay flat; "change frames" additionally rebuild the
+ * view model after a watchlist edit. Heap allocations made through
+ * operator new (ImGui uses its own allocator) are counted per frame.
+ */
+
+namespace {
+
+std::atomic<size_t> allocation_count{ 0 };
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+struct FrameSample {
+    double cpu_us = 0.0;
+    int vertices = 0;
+    size_t allocations = 0;
+};
+
+FrameSample RunFrame(CryptoUI& ui) {
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1280, 800);
+    io.DeltaTime = 1.0f / 60.0f;
+
+    size_t allocations_before = allocation_count.load(std::memory_order_relaxed);
+    auto start = std::chrono::steady_clock::now();
+    ImGui::NewFrame();
+    ui.Render();
+    ImGui::Render();
+
+    FrameSample sample;
+    sample.cpu_us = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count();
+    sample.vertices = ImGui::GetDrawData()->TotalVtxCount;
+    sample.allocations = allocation_count.load(std::memory_order_relaxed) - allocations_before;
+    return sample;
+}
+
+double Median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+void RunScenario(size_t coin_count) {
+    PriceManagerConfig config;
+    config.start_update_thread = false;
+    config.persist_watchlist = false;
+    config.persist_ticks = false;
+    config.log_to_console = false;
+    auto manager = std::make_shared<PriceManager>(CreateDefaultTransport(), config);
+    std::vector<CoinInfo> universe = MakeUniverse(coin_count);
+    manager->SetTrackedCoins(universe);
+    for (size_t i = 0; i < coin_count; i += std::max<size_t>(1, coin_count / 10)) {
+        manager->AddToWatchlist(universe[i].id);
+    }
+
+    CryptoUI ui(manager);
+
+    // Warm up (first frame builds the font atlas and the view model)
+    for (int i = 0; i < 10; ++i) {
+        RunFrame(ui);
+    }
+
+    const int frames = 200;
+    std::vector<double> steady, changed;
+    int vertices = 0;
+    size_t allocations = 0;
+    for (int i = 0; i < frames; ++i) {
+        FrameSample sample = RunFrame(ui);
+        steady.push_back(sample.cpu_us);
+        vertices = sample.vertices;
+        allocations += sample.allocations;
+    }
+
+    // Every frame follows a data change, so the view model is rebuilt each time
+    const std::string& toggled = universe[coin_count / 2].id;
+    for (int i = 0; i < frames / 4; ++i) {
+        if (i % 2 == 0) manager->AddToWatchlist(toggled);
+        else manager->RemoveFromWatchlist(toggled);
+        changed.push_back(RunFrame(ui).cpu_us);
+    }
+
+    std::printf("%8zu %14.1f %16.1f %10d %14.2f\n", coin_count, Median(steady), Median(changed), vertices,
+        static_cast<double>(allocations) / frames);
+}
+
+} // namespace
+
+int main() {
+    CreateHeadlessImGuiContext();
+
+    std::printf("Headless frame benchmark (median CPU microseconds per frame)\n\n");
+    std::printf("%8s %14s %16s %10s %14s\n", "coins", "steady_us", "change_frame_us", "vertices", "allocs/frame");
+
+    RunScenario(100);
+    RunScenario(1000);
+    RunScenario(15000);
+    RunScenario(100000);
+
+    ImGui::DestroyContext();
+    return 0;
+}
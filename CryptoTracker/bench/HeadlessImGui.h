@@ -0,0 +1,21 @@
+#pragma once
+#include <imgui.h>
+
+/**
+ * @brief Create an ImGui context that renders without a window or GPU
+ *
+ * Bakes the default font atlas up front, since no renderer backend will.
+ */
+inline void CreateHeadlessImGuiContext() {
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(1280, 800);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.Fonts->AddFontDefault();
+
+    unsigned char* pixels = nullptr;
+    int width = 0, height = 0;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+}
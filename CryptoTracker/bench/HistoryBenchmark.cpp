@@ -0,0 +1,142 @@
+#include "PriceHistory.h"
+#include "PriceManager.h"
+#include "BenchUtil.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Price history benchmark
+ *
+ * Reports the ring capacity and arena size the default PriceManagerConfig
+ * budget gives for growing coin universes, the cost of appending one tick
+ * for every coin of a 15k universe, the cost of window reads, and checks
+ * that readers running concurrently with the writer never see a torn or
+ * out-of-order sample.
+ */
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int64_t TICK_MS = 30000;
+
+double PriceAt(size_t index, int64_t timestamp_ms) {
+    // Reader can recompute it from the timestamp to detect torn samples
+    return static_cast<double>(index) + static_cast<double>(timestamp_ms) * 0.5;
+}
+
+void ReportBudget(size_t coin_count, const PriceManagerConfig& config) {
+    auto catalog = std::make_shared<const CoinCatalog>(MakeUniverse(coin_count));
+    PriceHistory history(catalog, config.history_capacity, config.history_budget_bytes);
+    double hours = static_cast<double>(history.Capacity()) * TICK_MS / 3600000.0;
+    std::printf("%8zu %10zu %10.1f %10.1f\n", coin_count, history.Capacity(),
+        static_cast<double>(history.MemoryBytes()) / (1024.0 * 1024.0), hours);
+}
+
+void RunThroughput(const PriceManagerConfig& config) {
+    const size_t coin_count = 15000;
+    auto catalog = std::make_shared<const CoinCatalog>(MakeUniverse(coin_count));
+    PriceHistory history(catalog, config.history_capacity, config.history_budget_bytes);
+
+    // Fill every ring twice over so appends overwrite
+    const int ticks = static_cast<int>(history.Capacity() * 2);
+    auto start = Clock::now();
+    for (int t = 0; t < ticks; ++t) {
+        int64_t now_ms = t * TICK_MS;
+        for (size_t i = 0; i < coin_count; ++i) {
+            history.Append(i, now_ms, PriceAt(i, now_ms));
+        }
+    }
+    double append_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() /
+        (static_cast<double>(ticks) * coin_count);
+    std::printf("\nAppend: %.1f ns per sample, %.2f ms per 15k-coin tick\n",
+        append_ns, append_ns * coin_count / 1e6);
+
+    std::vector<PriceSample> out;
+    int64_t newest = (ticks - 1) * TICK_MS;
+    const int64_t windows[] = {
+        0,                                                          // Whole ring
+        newest - static_cast<int64_t>(history.Capacity() / 4) * TICK_MS, // Last quarter
+        newest - 60 * 60 * 1000,                                    // Last hour
+    };
+    const char* labels[] = { "whole ring", "last quarter", "last hour" };
+    for (int w = 0; w < 3; ++w) {
+        int64_t from = windows[w];
+        size_t samples = 0;
+        const int reads = 20000;
+        start = Clock::now();
+        for (int r = 0; r < reads; ++r) {
+            samples += history.ReadWindow(static_cast<size_t>(r) % coin_count, from, newest, out);
+        }
+        double read_us = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / reads;
+        std::printf("ReadWindow (%s): %.2f us, %zu samples\n", labels[w], read_us, samples / reads);
+    }
+}
+
+void RunConcurrent(const PriceManagerConfig& config) {
+    const size_t coin_count = 15000;
+    auto catalog = std::make_shared<const CoinCatalog>(MakeUniverse(coin_count));
+    PriceHistory history(catalog, config.history_capacity, config.history_budget_bytes);
+
+    std::atomic<bool> stop{ false };
+    std::atomic<uint64_t> reads{ 0 }, torn{ 0 }, unordered{ 0 };
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r) {
+        readers.emplace_back([&, r] {
+            std::vector<PriceSample> out;
+            size_t index = static_cast<size_t>(r);
+            while (!stop.load(std::memory_order_relaxed)) {
+                // Hot coins: the writer keeps overwriting the rings being read
+                index = (index + 1) % 16;
+                history.ReadWindow(index, 0, INT64_MAX, out);
+                for (size_t s = 0; s < out.size(); ++s) {
+                    if (out[s].price != PriceAt(index, out[s].timestamp_ms)) ++torn;
+                    if (s > 0 && out[s].timestamp_ms <= out[s - 1].timestamp_ms) ++unordered;
+                }
+                ++reads;
+            }
+        });
+    }
+
+    // Writer: one 15k-coin tick after another
+    auto start = Clock::now();
+    uint64_t appended = 0;
+    for (int64_t t = 0; Clock::now() - start < std::chrono::seconds(1); ++t) {
+        int64_t now_ms = t * TICK_MS;
+        for (size_t i = 0; i < coin_count; ++i) {
+            history.Append(i, now_ms, PriceAt(i, now_ms));
+        }
+        appended += coin_count;
+    }
+    stop.store(true);
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    std::printf("\nConcurrent (1 writer, 2 readers, 1 s): %llu samples appended, %llu window reads, "
+        "%llu torn, %llu out of order\n",
+        static_cast<unsigned long long>(appended), static_cast<unsigned long long>(reads.load()),
+        static_cast<unsigned long long>(torn.load()), static_cast<unsigned long long>(unordered.load()));
+}
+
+} // namespace
+
+int main() {
+    PriceManagerConfig config;
+    std::printf("Price history benchmark (default budget %zu MiB, up to %zu samples per coin)\n\n",
+        config.history_budget_bytes / (1024 * 1024), config.history_capacity);
+    std::printf("%8s %10s %10s %10s\n", "coins", "capacity", "arena_MiB", "hours@30s");
+
+    ReportBudget(20, config);
+    ReportBudget(1000, config);
+    ReportBudget(15000, config);
+    ReportBudget(100000, config);
+
+    RunThroughput(config);
+    RunConcurrent(config);
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include "CryptoUI.h"
+#include "FramePacer.h"
+#include "BenchUtil.h"
+#include "HeadlessImGui.h"
+#include <imgui.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+/**
+ * @brief Render-on-demand frame count over a simulated minute
+ *
+ * Runs the main-loop decision logic (CryptoUI::NeedsFrame / IdleTimeout)
+ * against a headless ImGui context on a virtual clock: one idle minute
+ * with two data updates (as the 30 s refresh would publish) and one short
+ * burst of mouse input. Reports frames rendered versus a continuous 60 Hz
+ * loop, plus the pacing of a blinking text cursor.
+ */
+
+namespace {
+
+using Clock = FramePacer::Clock;
+constexpr auto VSYNC = std::chrono::microseconds(16667);
+constexpr auto MINUTE = std::chrono::seconds(60);
+
+void RunUiMinute() {
+    PriceManagerConfig config;
+    config.start_update_thread = false;
+    config.persist_watchlist = false;
+    config.persist_ticks = false;
+    config.log_to_console = false;
+    auto manager = std::make_shared<PriceManager>(CreateDefaultTransport(), config);
+    manager->SetTrackedCoins(MakeUniverse(1000));
+    CryptoUI ui(manager);
+
+    const Clock::time_point start = Clock::now();
+    const Clock::time_point end = start + MINUTE;
+
+    // Scripted events (virtual time offsets)
+    const Clock::duration data_changes[] = { std::chrono::seconds(15), std::chrono::seconds(45) };
+    const Clock::duration input_burst = std::chrono::seconds(20);
+    const int input_events = 10;    // Mouse moves, one per vsync
+    size_t next_data = 0;
+    int inputs_sent = 0;
+
+    Clock::time_point now = start;
+    uint64_t wakeups = 0;
+    while (now < end) {
+        // Deliver events that are due
+        while (next_data < std::size(data_changes) && start + data_changes[next_data] <= now) {
+            manager->AddToWatchlist(next_data == 0 ? "coin-00001" : "coin-00002");
+            ++next_data;
+        }
+        if (inputs_sent < input_events && start + input_burst + inputs_sent * VSYNC <= now) {
+            ImGui::GetIO().AddMousePosEvent(100.0f + inputs_sent * 10.0f, 200.0f);
+            ui.OnInputEvent();
+            ++inputs_sent;
+        }
+
+        if (ui.NeedsFrame(now)) {
+            ImGui::GetIO().DeltaTime = std::chrono::duration<float>(VSYNC).count();
+            ImGui::NewFrame();
+            ui.Render(now);
+            ImGui::Render();
+            now += VSYNC;
+            continue;
+        }
+
+        // Block until the next scripted event or the pacer's deadline
+        ++wakeups;
+        Clock::time_point wake = end;
+        if (next_data < std::size(data_changes)) wake = std::min(wake, start + data_changes[next_data]);
+        if (inputs_sent < input_events) wake = std::min(wake, start + input_burst + inputs_sent * VSYNC);
+        Clock::duration idle = ui.IdleTimeout(now);
+        if (idle != Clock::duration::max()) wake = std::min(wake, now + idle);
+        now = std::max(wake, now + std::chrono::microseconds(1));
+    }
+
+    uint64_t continuous = static_cast<uint64_t>(MINUTE / VSYNC);
+    std::printf("Idle minute (2 data updates, 1 input burst): %llu frames on demand vs %llu continuous "
+        "(%.1f%%), %llu wake-ups\n",
+        static_cast<unsigned long long>(ui.FramesRendered()), static_cast<unsigned long long>(continuous),
+        100.0 * ui.FramesRendered() / continuous, static_cast<unsigned long long>(wakeups));
+}
+
+void RunCursorBlinkMinute() {
+    FramePacer pacer;
+    Clock::time_point now = Clock::now();
+    const Clock::time_point end = now + MINUTE;
+
+    while (now < end) {
+        if (pacer.ShouldRender(now)) {
+            pacer.FrameRendered(true, now);     // Search box keeps focus
+            now += VSYNC;
+        }
+        else {
+            now += pacer.TimeUntilNextFrame(now);
+        }
+    }
+    std::printf("Focused text field for a minute: %llu frames\n",
+        static_cast<unsigned long long>(pacer.FramesRendered()));
+}
+
+} // namespace
+
+int main() {
+    CreateHeadlessImGuiContext();
+
+    std::printf("Render-on-demand benchmark (simulated 60 s, 60 Hz display)\n\n");
+    RunUiMinute();
+    RunCursorBlinkMinute();
+
+    ImGui::DestroyContext();
+    return 0;
+}
@@ -0,0 +1,102 @@
+#include "PriceManager.h"
+#include "CoinCatalog.h"
+#include "BenchUtil.h"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Coin lookup benchmark
+ *
+ * Measures the cost of resolving coin IDs (CoinIndex and the
+ * PriceManager watchlist paths built on it) against a linear scan, for
+ * growing universe sizes. Indexed cost should stay flat.
+ */
+
+namespace {
+
+// Simple LCG so runs are reproducible without <random> overhead in the loop
+size_t NextRandom(size_t& state) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<size_t>(state >> 33);
+}
+
+void RunScenario(size_t coin_count) {
+    std::vector<CoinInfo> universe = MakeUniverse(coin_count);
+
+    // Probe a few hundred watchlist-like ids spread over the universe
+    std::vector<std::string> probes;
+    size_t rng = 42;
+    for (int i = 0; i < 512; ++i) {
+        probes.push_back(universe[NextRandom(rng) % coin_count].id);
+    }
+
+    CoinCatalog catalog(universe);
+    const CoinIndex& index = catalog.Index();
+
+    const int rounds = 2000;
+    size_t found = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        for (const auto& id : probes) {
+            found += index.FindById(id) != CoinIndex::NOT_FOUND;
+        }
+    }
+    double index_ns = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / (rounds * probes.size());
+
+    // Linear scan baseline (what the watchlist paths used to do)
+    const int scan_rounds = coin_count > 10000 ? 2 : 20;
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < scan_rounds; ++r) {
+        for (const auto& id : probes) {
+            for (const auto& coin : universe) {
+                if (coin.id == id) {
+                    ++found;
+                    break;
+                }
+            }
+        }
+    }
+    double scan_ns = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / (scan_rounds * probes.size());
+
+    // Watchlist add/remove through PriceManager (lock + index lookup)
+    PriceManagerConfig config;
+    config.start_update_thread = false;
+    config.persist_watchlist = false;
+    config.persist_ticks = false;
+    config.log_to_console = false;
+    PriceManager manager(CreateDefaultTransport(), config);
+    manager.SetTrackedCoins(universe);
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds / 10; ++r) {
+        for (const auto& id : probes) {
+            manager.AddToWatchlist(id);
+        }
+        for (const auto& id : probes) {
+            manager.RemoveFromWatchlist(id);
+        }
+    }
+    double watchlist_ns = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / (rounds / 10 * probes.size() * 2);
+
+    std::printf("%8zu %14.1f %16.1f %14.1f   (%zu hits)\n",
+        coin_count, index_ns, watchlist_ns, scan_ns, found);
+}
+
+} // namespace
+
+int main() {
+    std::printf("Coin lookup benchmark (ns per lookup)\n\n");
+    std::printf("%8s %14s %16s %14s\n", "coins", "index_ns", "watchlist_op_ns", "linear_ns");
+
+    RunScenario(20);
+    RunScenario(1000);
+    RunScenario(15000);
+    RunScenario(100000);
+    return 0;
+}
@@ -0,0 +1,282 @@
+#include "MockPriceServer.h"
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <strings.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+
+MockPriceServer::~MockPriceServer() {
+    Stop();
+}
+
+uint16_t MockPriceServer::Start() {
+    listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_fd < 0) return 0;
+
+    int yes = 1;
+    setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+
+    if (bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        listen(listen_fd, 64) != 0) {
+        close(listen_fd);
+        listen_fd = -1;
+        return 0;
+    }
+
+    socklen_t len = sizeof(addr);
+    getsockname(listen_fd, reinterpret_cast<sockaddr*>(&addr), &len);
+
+    running.store(true);
+    accept_thread = std::thread(&MockPriceServer::AcceptLoop, this);
+    return ntohs(addr.sin_port);
+}
+
+void MockPriceServer::Stop() {
+    if (!running.exchange(false)) return;
+
+    shutdown(listen_fd, SHUT_RDWR);
+    close(listen_fd);
+    if (accept_thread.joinable()) {
+        accept_thread.join();
+    }
+
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex);
+        for (int fd : connection_fds) {
+            shutdown(fd, SHUT_RDWR);
+        }
+        threads.swap(connection_threads);
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+void MockPriceServer::AcceptLoop() {
+    while (running.load()) {
+        int fd = accept(listen_fd, nullptr, nullptr);
+        if (fd < 0) {
+            if (!running.load()) break;
+            continue;
+        }
+
+        int yes = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+
+        std::lock_guard<std::mutex> lock(connections_mutex);
+        connection_fds.push_back(fd);
+        connection_threads.emplace_back(&MockPriceServer::ServeConnection, this, fd);
+    }
+}
+
+void MockPriceServer::ServeConnection(int fd) {
+    std::string pending;
+    char chunk[16384];
+    bool keep_alive = true;
+
+    while (keep_alive && running.load()) {
+        // Read one request head
+        size_t head_end;
+        while ((head_end = pending.find("\r\n\r\n")) == std::string::npos) {
+            ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+            if (n <= 0) {
+                keep_alive = false;
+                break;
+            }
+            pending.append(chunk, static_cast<size_t>(n));
+        }
+        if (!keep_alive) break;
+
+        std::string head = pending.substr(0, head_end);
+        pending.erase(0, head_end + 4);
+
+        // Request line: GET <target> HTTP/1.1
+        size_t sp1 = head.find(' ');
+        size_t sp2 = head.find(' ', sp1 + 1);
+        std::string target = head.substr(sp1 + 1, sp2 - sp1 - 1);
+
+        for (size_t pos = head.find("\r\n"); pos != std::string::npos; pos = head.find("\r\n", pos + 2)) {
+            if (strncasecmp(head.c_str() + pos + 2, "Connection: close", 17) == 0) {
+                keep_alive = false;
+            }
+        }
+
+        long long delay = response_delay_ms.load();
+        if (delay > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+        }
+
+        bool coin_list = target.rfind("/api/v3/coins/list", 0) == 0;
+        while (!coin_list && failure.load() == Failure::Hang && running.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        bool fail = !coin_list && failure.load() == Failure::ServerError;
+        std::string limit_headers;
+        bool throttled = !coin_list && !fail && !AdmitRequest(limit_headers);
+
+        std::string body = coin_list ? BuildCoinListBody() : fail ? "Service Unavailable" :
+            throttled ? "Too Many Requests" : BuildPriceBody(target);
+        std::string response = std::string(fail ? "HTTP/1.1 503 Service Unavailable\r\n"
+            "Content-Type: text/plain\r\n" : throttled ? "HTTP/1.1 429 Too Many Requests\r\n"
+            "Content-Type: text/plain\r\n" : "HTTP/1.1 200 OK\r\n"
+            "Content-Type: application/json\r\n") + limit_headers +
+            "Content-Length: " + std::to_string(body.size()) + "\r\n" +
+            (keep_alive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n") +
+            body;
+
+        size_t sent = 0;
+        while (sent < response.size()) {
+            ssize_t n = send(fd, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0) {
+                keep_alive = false;
+                break;
+            }
+            sent += static_cast<size_t>(n);
+        }
+        requests_served.fetch_add(1);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex);
+        for (auto it = connection_fds.begin(); it != connection_fds.end(); ++it) {
+            if (*it == fd) {
+                connection_fds.erase(it);
+                break;
+            }
+        }
+    }
+    close(fd);
+}
+
+void MockPriceServer::SetRateLimit(size_t requests, std::chrono::milliseconds window, bool advertise) {
+    std::lock_guard<std::mutex> lock(limit_mutex);
+    limit_requests = requests;
+    limit_window = window;
+    limit_advertised = advertise;
+    window_start = std::chrono::steady_clock::now();
+    window_count = 0;
+}
+
+bool MockPriceServer::AdmitRequest(std::string& headers) {
+    std::lock_guard<std::mutex> lock(limit_mutex);
+    if (limit_requests == 0) return true;
+
+    auto now = std::chrono::steady_clock::now();
+    if (now - window_start >= limit_window) {
+        window_start = now;
+        window_count = 0;
+    }
+    bool admitted = window_count < limit_requests;
+    if (admitted) ++window_count;
+
+    auto reset_ms = std::chrono::duration_cast<std::chrono::milliseconds>(window_start + limit_window - now).count();
+    long long reset_s = (reset_ms + 999) / 1000;
+    if (limit_advertised) {
+        headers = "X-RateLimit-Limit: " + std::to_string(limit_requests) + "\r\n"
+            "X-RateLimit-Remaining: " + std::to_string(limit_requests - window_count) + "\r\n"
+            "X-RateLimit-Reset: " + std::to_string(reset_s) + "\r\n";
+    }
+    if (!admitted) {
+        headers += "Retry-After: " + std::to_string(reset_s) + "\r\n";
+        requests_throttled.fetch_add(1);
+    }
+    return admitted;
+}
+
+std::string MockPriceServer::BuildPriceBody(const std::string& target) {
+    size_t ids_pos = target.find("ids=");
+    if (ids_pos == std::string::npos) return "{}";
+    ids_pos += 4;
+    size_t ids_end = target.find('&', ids_pos);
+    if (ids_end == std::string::npos) ids_end = target.size();
+
+    uint64_t tick = requests_served.load();
+    double scale = price_scale.load();
+    bool waves = wave_share.load() > 0.0;
+    auto now = std::chrono::steady_clock::now();
+    std::string body = "{";
+    body.reserve((ids_end - ids_pos) * 6 + 2);
+
+    char entry[256];
+    size_t start = ids_pos;
+    bool first = true;
+    while (start < ids_end) {
+        size_t comma = target.find(',', start);
+        if (comma == std::string::npos || comma > ids_end) comma = ids_end;
+        std::string id = target.substr(start, comma - start);
+        start = comma + 1;
+        if (id.empty()) continue;
+
+        // Deterministic price per id that drifts with every request
+        size_t h = std::hash<std::string>{}(id);
+        double base = 0.0001 + static_cast<double>(h % 100000) / 10.0;
+        double drift = static_cast<double>((h + tick * 7919) % 2001) / 1000.0 - 1.0;
+        double price = base * (1.0 + drift / 100.0) * scale;
+        double change = drift * 5.0;
+        if (waves) {
+            // Change measured against the wave's midpoint
+            price = PriceAt(id, now);
+            change = (price / base - 1.0) * 100.0;
+            price *= scale;
+        }
+
+        int n = std::snprintf(entry, sizeof(entry), "%s\"%s\":{\"usd\":%.8g,\"usd_24h_change\":%.6f}",
+            first ? "" : ",", id.c_str(), price, change);
+        body.append(entry, static_cast<size_t>(n));
+        first = false;
+    }
+
+    body += "}";
+    return body;
+}
+
+void MockPriceServer::SetPriceWaves(double volatile_share, double amplitude, std::chrono::milliseconds period) {
+    wave_amplitude.store(amplitude);
+    wave_period_ms.store(std::max<long long>(1, period.count()));
+    wave_share.store(volatile_share);
+}
+
+bool MockPriceServer::IsVolatile(std::string_view id) const {
+    size_t h = std::hash<std::string_view>{}(id);
+    return static_cast<double>((h >> 20) % 10000) < wave_share.load() * 10000.0;
+}
+
+double MockPriceServer::PriceAt(std::string_view id, std::chrono::steady_clock::time_point at) const {
+    size_t h = std::hash<std::string_view>{}(id);
+    double base = 0.0001 + static_cast<double>(h % 100000) / 10.0;
+    double amplitude = wave_amplitude.load() / (IsVolatile(id) ? 1.0 : 50.0);
+    double phase = static_cast<double>(h % 6283) / 1000.0;
+    double t = std::chrono::duration<double, std::milli>(at.time_since_epoch()).count() /
+        static_cast<double>(wave_period_ms.load());
+    return base * (1.0 + amplitude * std::sin(2.0 * 3.141592653589793 * t + phase));
+}
+
+std::string MockPriceServer::BuildCoinListBody() {
+    size_t count = coin_list_size.load();
+    std::string body = "[";
+    body.reserve(count * 64 + 2);
+
+    char entry[128];
+    for (size_t i = 0; i < count; ++i) {
+        int n = std::snprintf(entry, sizeof(entry),
+            "%s{\"id\":\"coin-%05zu\",\"symbol\":\"c%zu\",\"name\":\"Coin %zu\"}",
+            i == 0 ? "" : ",", i, i, i);
+        body.append(entry, static_cast<size_t>(n));
+    }
+
+    body += "]";
+    return body;
+}
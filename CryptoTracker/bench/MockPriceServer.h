@@ -0,0 +1,142 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <chrono>
+
+/**
+ * @brief Local stand-in for the CoinGecko /simple/price endpoint
+ *
+ * Listens on 127.0.0.1 (ephemeral port) and answers
+ * GET /api/v3/simple/price?ids=a,b,c with a JSON object containing
+ * "usd" and "usd_24h_change" for every requested id. Prices drift on every
+ * request so each fetch produces real updates. Also serves
+ * GET /api/v3/coins/list for a synthetic universe matching MakeUniverse().
+ * Supports HTTP/1.1 keep-alive, an artificial per-request latency and
+ * failure modes, so several instances can stand in for price providers.
+ * POSIX only; used by the benchmarks.
+ */
+class MockPriceServer {
+public:
+    /**
+     * @brief How price requests fail
+     */
+    enum class Failure {
+        None,           // Answer normally
+        ServerError,    // 503 with a plain-text body
+        Hang            // Never answer (until the mode changes or the server stops)
+    };
+
+    MockPriceServer() = default;
+    ~MockPriceServer();
+
+    /**
+     * @brief Bind and start serving on a background thread
+     * @return Port the server listens on, or 0 on failure
+     */
+    uint16_t Start();
+
+    /**
+     * @brief Stop accepting, close all connections and join threads
+     */
+    void Stop();
+
+    /**
+     * @brief Number of requests answered so far
+     */
+    uint64_t RequestsServed() const { return requests_served.load(); }
+
+    /**
+     * @brief Number of coins returned by /coins/list
+     */
+    void SetCoinListSize(size_t count) { coin_list_size.store(count); }
+
+    /**
+     * @brief Delay every response to emulate network/server latency
+     */
+    void SetResponseDelay(std::chrono::milliseconds delay) { response_delay_ms.store(delay.count()); }
+
+    /**
+     * @brief Make price requests fail (the coin list is still served)
+     */
+    void SetFailure(Failure mode) { failure.store(mode); }
+
+    /**
+     * @brief Multiply every price, to emulate a provider quoting off-market
+     */
+    void SetPriceScale(double scale) { price_scale.store(scale); }
+
+    /**
+     * @brief Quote prices from a time-based model of calm and volatile coins
+     *
+     * 'volatile_share' of the ids (picked by hash) swing by +-'amplitude'
+     * over 'period'; the others by 1/50th of that. Prices then depend on
+     * the time of the request only, so PriceAt() tells a benchmark what an
+     * up-to-date client would show; the 24h change is the distance from
+     * the midpoint. A zero share restores the per-request drift.
+     */
+    void SetPriceWaves(double volatile_share, double amplitude, std::chrono::milliseconds period);
+
+    /**
+     * @brief Price the wave model quotes for 'id' at 'at'
+     */
+    double PriceAt(std::string_view id, std::chrono::steady_clock::time_point at) const;
+
+    /**
+     * @brief Whether 'id' is one of the wave model's volatile coins
+     */
+    bool IsVolatile(std::string_view id) const;
+
+    /**
+     * @brief Enforce a fixed-window rate limit on price requests (0 = none)
+     *
+     * Requests beyond 'requests' per window get 429 with Retry-After. With
+     * 'advertise' every price response also carries X-RateLimit-Remaining
+     * and X-RateLimit-Reset.
+     */
+    void SetRateLimit(size_t requests, std::chrono::milliseconds window, bool advertise = true);
+
+    /**
+     * @brief Number of requests answered with 429
+     */
+    uint64_t RequestsThrottled() const { return requests_throttled.load(); }
+
+private:
+    void AcceptLoop();
+    void ServeConnection(int fd);
+    std::string BuildPriceBody(const std::string& target);
+    std::string BuildCoinListBody();
+
+    /**
+     * @brief Count a price request against the rate limit
+     * @param headers Receives the rate-limit headers to send
+     * @return false if the request is over the limit
+     */
+    bool AdmitRequest(std::string& headers);
+
+    int listen_fd = -1;
+    std::atomic<bool> running{ false };
+    std::atomic<uint64_t> requests_served{ 0 };
+    std::atomic<size_t> coin_list_size{ 0 };
+    std::atomic<long long> response_delay_ms{ 0 };
+    std::atomic<Failure> failure{ Failure::None };
+    std::atomic<double> price_scale{ 1.0 };
+    std::atomic<double> wave_share{ 0.0 };      // Volatile fraction of the wave model (0 = off)
+    std::atomic<double> wave_amplitude{ 0.0 };
+    std::atomic<long long> wave_period_ms{ 1 };
+    std::atomic<uint64_t> requests_throttled{ 0 };
+    std::mutex limit_mutex;                     // Guards the rate-limit window
+    size_t limit_requests = 0;
+    std::chrono::milliseconds limit_window{ 0 };
+    bool limit_advertised = true;
+    std::chrono::steady_clock::time_point window_start;
+    size_t window_count = 0;
+    std::thread accept_thread;
+    std::mutex connections_mutex;
+    std::vector<int> connection_fds;
+    std::vector<std::thread> connection_threads;
+};
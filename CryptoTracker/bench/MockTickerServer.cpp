@@ -0,0 +1,218 @@
+#include "MockTickerServer.h"
+#include "HttpTransport.h"
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <strings.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+bool SendAll(int fd, const std::string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        sent += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+/**
+ * @brief Append one ticker object with the fields of a Binance 24hrTicker event
+ */
+void AppendTicker(std::string& out, const char* symbol, double price, double change, int64_t event_ms) {
+    char entry[512];
+    int n = std::snprintf(entry, sizeof(entry),
+        "{\"e\":\"24hrTicker\",\"E\":%lld,\"s\":\"%sUSDT\",\"p\":\"%.8f\",\"P\":\"%.3f\",\"w\":\"%.8f\","
+        "\"x\":\"%.8f\",\"c\":\"%.8f\",\"Q\":\"1.00000000\",\"b\":\"%.8f\",\"B\":\"10.00000000\","
+        "\"a\":\"%.8f\",\"A\":\"10.00000000\",\"o\":\"%.8f\",\"h\":\"%.8f\",\"l\":\"%.8f\","
+        "\"v\":\"12345.00000000\",\"q\":\"67890.00000000\",\"O\":%lld,\"C\":%lld,\"F\":1,\"L\":1000,\"n\":1000}",
+        static_cast<long long>(event_ms), symbol, price * change / 100.0, change, price, price, price,
+        price * 0.9999, price * 1.0001, price / (1.0 + change / 100.0), price * 1.05, price * 0.95,
+        static_cast<long long>(event_ms - 86400000), static_cast<long long>(event_ms));
+    out.append(entry, static_cast<size_t>(n));
+}
+
+} // namespace
+
+MockTickerServer::~MockTickerServer() {
+    Stop();
+}
+
+uint16_t MockTickerServer::Start() {
+    listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_fd < 0) return 0;
+
+    int yes = 1;
+    setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+
+    if (bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        listen(listen_fd, 64) != 0) {
+        close(listen_fd);
+        listen_fd = -1;
+        return 0;
+    }
+
+    socklen_t len = sizeof(addr);
+    getsockname(listen_fd, reinterpret_cast<sockaddr*>(&addr), &len);
+
+    running.store(true);
+    accept_thread = std::thread(&MockTickerServer::AcceptLoop, this);
+    return ntohs(addr.sin_port);
+}
+
+void MockTickerServer::Stop() {
+    if (!running.exchange(false)) return;
+
+    shutdown(listen_fd, SHUT_RDWR);
+    close(listen_fd);
+    if (accept_thread.joinable()) {
+        accept_thread.join();
+    }
+
+    DropConnections();
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex);
+        threads.swap(connection_threads);
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+void MockTickerServer::DropConnections() {
+    std::lock_guard<std::mutex> lock(connections_mutex);
+    for (int fd : connection_fds) {
+        shutdown(fd, SHUT_RDWR);
+    }
+}
+
+void MockTickerServer::AcceptLoop() {
+    while (running.load()) {
+        int fd = accept(listen_fd, nullptr, nullptr);
+        if (fd < 0) {
+            if (!running.load()) break;
+            continue;
+        }
+
+        int yes = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+
+        std::lock_guard<std::mutex> lock(connections_mutex);
+        connection_fds.push_back(fd);
+        connection_threads.emplace_back(&MockTickerServer::ServeConnection, this, fd);
+    }
+}
+
+void MockTickerServer::BuildMessage(std::string& frame, uint64_t& cursor) {
+    using namespace std::chrono;
+    int64_t event_ms = duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+    size_t count = tickers_per_message.load();
+    size_t universe = universe_size.load();
+
+    std::string payload;
+    payload.reserve(count * 420 + 2);
+    if (count > 1) payload += '[';
+
+    // Probe first: its price is the send time
+    double sent_us = static_cast<double>(duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+    AppendTicker(payload, PROBE_SYMBOL, sent_us, 0.0, event_ms);
+
+    char symbol[32];
+    for (size_t i = 1; i < count && universe > 0; ++i, ++cursor) {
+        size_t coin = cursor % universe;
+        std::snprintf(symbol, sizeof(symbol), "C%zu", coin);
+        double drift = static_cast<double>((coin * 7919 + cursor) % 2001) / 1000.0 - 1.0;
+        payload += ',';
+        AppendTicker(payload, symbol, (1.0 + static_cast<double>(coin)) * (1.0 + drift / 100.0), drift * 5.0, event_ms);
+    }
+    if (count > 1) payload += ']';
+
+    // Unmasked text frame
+    frame.clear();
+    frame += static_cast<char>(0x81);
+    if (payload.size() < 126) {
+        frame += static_cast<char>(payload.size());
+    }
+    else if (payload.size() <= 0xFFFF) {
+        frame += static_cast<char>(126);
+        frame += static_cast<char>(payload.size() >> 8);
+        frame += static_cast<char>(payload.size() & 0xFF);
+    }
+    else {
+        frame += static_cast<char>(127);
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            frame += static_cast<char>((static_cast<uint64_t>(payload.size()) >> shift) & 0xFF);
+        }
+    }
+    frame += payload;
+}
+
+void MockTickerServer::ServeConnection(int fd) {
+    // Upgrade request
+    std::string head;
+    char chunk[4096];
+    while (head.find("\r\n\r\n") == std::string::npos) {
+        ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0) break;
+        head.append(chunk, static_cast<size_t>(n));
+    }
+
+    std::string key;
+    for (size_t pos = head.find("\r\n"); pos != std::string::npos; pos = head.find("\r\n", pos + 2)) {
+        if (strncasecmp(head.c_str() + pos + 2, "Sec-WebSocket-Key:", 18) == 0) {
+            size_t begin = head.find_first_not_of(' ', pos + 20);
+            key = head.substr(begin, head.find("\r\n", begin) - begin);
+        }
+    }
+
+    bool upgraded = false;
+    if (!key.empty() && !reject_handshakes.load()) {
+        upgraded = SendAll(fd, "HTTP/1.1 101 Switching Protocols\r\n"
+            "Upgrade: websocket\r\n"
+            "Connection: Upgrade\r\n"
+            "Sec-WebSocket-Accept: " + WebSocketAccept(key) + "\r\n\r\n");
+    }
+    else {
+        SendAll(fd, "HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+    }
+
+    // Push tickers until the client goes away, the stream is dropped or the server stops
+    std::string frame;
+    uint64_t cursor = 0;
+    auto next_send = std::chrono::steady_clock::now();
+    while (upgraded && running.load()) {
+        double rate = message_rate.load();
+        if (rate > 0.0) {
+            next_send += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(1.0 / rate));
+            std::this_thread::sleep_until(next_send);
+        }
+        BuildMessage(frame, cursor);
+        if (!SendAll(fd, frame)) break;
+        messages_sent.fetch_add(1);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex);
+        for (auto it = connection_fds.begin(); it != connection_fds.end(); ++it) {
+            if (*it == fd) {
+                connection_fds.erase(it);
+                break;
+            }
+        }
+    }
+    close(fd);
+}
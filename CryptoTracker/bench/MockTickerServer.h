@@ -0,0 +1,85 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Local stand-in for an exchange WebSocket ticker stream
+ *
+ * Listens on 127.0.0.1 (ephemeral port), accepts WebSocket upgrades on any
+ * path and pushes Binance-style 24h ticker messages to every client: one
+ * ticker object per message, or an array of SetTickersPerMessage() tickers.
+ * Symbols are "C<i>USDT" for the MakeUniverse() coins. The first ticker of
+ * every message is PROBE_SYMBOL + "USDT", whose last price ("c") is the
+ * std::chrono::steady_clock time of sending in microseconds, so a reader in
+ * the same process can measure send-to-visible latency. POSIX only; used by
+ * the benchmarks.
+ */
+class MockTickerServer {
+public:
+    static constexpr const char* PROBE_SYMBOL = "PROBE";
+
+    MockTickerServer() = default;
+    ~MockTickerServer();
+
+    /**
+     * @brief Bind and start accepting on a background thread
+     * @return Port the server listens on, or 0 on failure
+     */
+    uint16_t Start();
+
+    /**
+     * @brief Stop accepting, close all streams and join threads
+     */
+    void Stop();
+
+    /**
+     * @brief Number of coins the tickers cycle through
+     */
+    void SetUniverseSize(size_t count) { universe_size.store(count); }
+
+    /**
+     * @brief Tickers per message; 1 sends a single object instead of an array
+     */
+    void SetTickersPerMessage(size_t count) { tickers_per_message.store(count); }
+
+    /**
+     * @brief Messages per second per client; 0 sends as fast as the socket drains
+     */
+    void SetMessageRate(double per_second) { message_rate.store(per_second); }
+
+    /**
+     * @brief Answer new upgrade requests with 503 instead of 101
+     */
+    void SetRejectHandshakes(bool reject) { reject_handshakes.store(reject); }
+
+    /**
+     * @brief Close every open stream (clients see a disconnect)
+     */
+    void DropConnections();
+
+    /**
+     * @brief Messages sent so far over all clients
+     */
+    uint64_t MessagesSent() const { return messages_sent.load(); }
+
+private:
+    void AcceptLoop();
+    void ServeConnection(int fd);
+    void BuildMessage(std::string& frame, uint64_t& cursor);
+
+    int listen_fd = -1;
+    std::atomic<bool> running{ false };
+    std::atomic<uint64_t> messages_sent{ 0 };
+    std::atomic<size_t> universe_size{ 1000 };
+    std::atomic<size_t> tickers_per_message{ 1 };
+    std::atomic<double> message_rate{ 0.0 };
+    std::atomic<bool> reject_handshakes{ false };
+    std::thread accept_thread;
+    std::mutex connections_mutex;
+    std::vector<int> connection_fds;
+    std::vector<std::thread> connection_threads;
+};
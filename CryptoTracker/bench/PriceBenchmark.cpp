@@ -0,0 +1,191 @@
+#include "PriceManager.h"
+#include "PosixHttpTransport.h"
+#include "MockPriceServer.h"
+#include "BenchUtil.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+
+/**
+ * @brief Headless throughput benchmark for the price pipeline
+ *
+ * Starts a local MockPriceServer and drives PriceManager::UpdatePrices
+ * (fetch -> parse -> update) against it for several coin universe sizes,
+ * reporting updates/sec, parse time and data_mutex hold time. Also times
+ * the scheduler: on-demand refresh wake-up, coalescing of concurrent
+ * refresh requests and shutdown during a slow request.
+ */
+
+namespace {
+
+void RunScenario(uint16_t port, size_t coin_count, int iterations, size_t concurrency = 4) {
+    PriceManagerConfig config;
+    config.max_concurrent_requests = concurrency;
+    config.api_endpoint = HttpEndpoint{ "127.0.0.1", port };
+    config.start_update_thread = false;
+    config.persist_watchlist = false;
+    config.persist_ticks = false;
+    config.log_to_console = false;
+
+    PriceManager manager(std::make_unique<PosixHttpTransport>(), config);
+    manager.SetTrackedCoins(MakeUniverse(coin_count));
+
+    // Warm up connection and allocator
+    manager.UpdatePrices();
+
+    double request_us = 0.0, parse_us = 0.0, lock_us = 0.0, max_lock_us = 0.0;
+    size_t updates = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < iterations; ++i) {
+        manager.UpdatePrices();
+        FetchStats stats = manager.GetLastFetchStats();
+        request_us += stats.request_us;
+        parse_us += stats.parse_us;
+        lock_us += stats.lock_hold_us;
+        if (stats.lock_hold_us > max_lock_us) max_lock_us = stats.lock_hold_us;
+        updates += stats.coins_updated;
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    TransportStats transport = manager.GetTransportStats();
+
+    std::printf("%8zu %6zu %7zu %8d %14.0f %12.1f %12.1f %12.1f %12.1f %12.1f %8llu %8llu\n",
+        coin_count, concurrency, manager.GetLastFetchStats().batches, iterations,
+        static_cast<double>(updates) / seconds,
+        iterations / seconds,
+        request_us / iterations,
+        parse_us / iterations,
+        lock_us / iterations,
+        max_lock_us,
+        static_cast<unsigned long long>(transport.connections_opened),
+        static_cast<unsigned long long>(transport.connections_reused));
+}
+
+PriceManagerConfig SchedulerConfig(uint16_t port) {
+    PriceManagerConfig config;
+    config.api_endpoint = HttpEndpoint{ "127.0.0.1", port };
+    config.persist_watchlist = false;
+    config.persist_ticks = false;
+    config.log_to_console = false;
+    config.update_interval = std::chrono::seconds(30);
+    return config;
+}
+
+void RunSchedulerScenarios(MockPriceServer& server, uint16_t port) {
+    using Clock = std::chrono::steady_clock;
+
+    // UpdatePrices() -> fetch done, with the update thread idle in its 30s wait
+    {
+        PriceManager manager(std::make_unique<PosixHttpTransport>(), SchedulerConfig(port));
+        manager.WaitForDataChange(1, std::chrono::seconds(5));      // Initial fetch
+
+        std::vector<double> latencies, call_us;
+        for (int i = 0; i < 50; ++i) {
+            auto start = Clock::now();
+            std::shared_future<bool> done = manager.UpdatePrices();
+            call_us.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+            done.wait();
+            latencies.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        }
+        std::sort(latencies.begin(), latencies.end());
+        std::sort(call_us.begin(), call_us.end());
+        std::printf("\nOn-demand refresh (20 coins): call returns in %.1f us (max %.1f), fetch done after "
+            "median %.2f ms, max %.2f ms\n", call_us[call_us.size() / 2], call_us.back(),
+            latencies[latencies.size() / 2], latencies.back());
+
+        // Burst of concurrent callers (spam-clicking, several panels) on a slow server
+        server.SetResponseDelay(std::chrono::milliseconds(50));
+        uint64_t requests_before = manager.GetTransportStats().requests;
+        std::vector<std::thread> callers;
+        for (int i = 0; i < 32; ++i) {
+            callers.emplace_back([&] {
+                for (int click = 0; click < 10; ++click) {
+                    manager.UpdatePrices();
+                    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                }
+                manager.UpdatePrices().wait();
+            });
+        }
+        for (auto& t : callers) {
+            t.join();
+        }
+        server.SetResponseDelay(std::chrono::milliseconds(0));
+        std::printf("Coalescing: 352 UpdatePrices() calls from 32 threads -> %llu fetches\n",
+            static_cast<unsigned long long>(manager.GetTransportStats().requests - requests_before));
+    }
+
+    // Destruction while a request is stuck on a slow server
+    server.SetResponseDelay(std::chrono::milliseconds(2000));
+    {
+        auto manager = std::make_unique<PriceManager>(std::make_unique<PosixHttpTransport>(), SchedulerConfig(port));
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));    // Let the first fetch block
+
+        auto start = Clock::now();
+        manager.reset();
+        std::printf("Shutdown with a 2 s request in flight: %.2f ms\n",
+            std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+    }
+    server.SetResponseDelay(std::chrono::milliseconds(0));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int scale = argc > 1 ? std::atoi(argv[1]) : 1;
+    if (scale < 1) scale = 1;
+
+    MockPriceServer server;
+    uint16_t port = server.Start();
+    if (port == 0) {
+        std::fprintf(stderr, "Failed to start mock price server\n");
+        return 1;
+    }
+
+    std::printf("Price pipeline benchmark (mock server on 127.0.0.1:%u)\n\n", port);
+    const char* header = "%8s %6s %7s %8s %14s %12s %12s %12s %12s %12s %8s %8s\n";
+    std::printf(header, "coins", "conc", "batches", "fetches", "updates/sec", "fetches/sec",
+        "request_us", "parse_us", "lock_us", "max_lock_us", "connects", "reuses");
+
+    RunScenario(port, 20, 200 * scale);
+    RunScenario(port, 1000, 50 * scale);
+    RunScenario(port, 15000, 10 * scale);
+
+    // Latency-bound refresh: total time should approach the slowest batch
+    std::printf("\nWith 20 ms server latency per request:\n");
+    std::printf(header, "coins", "conc", "batches", "fetches", "updates/sec", "fetches/sec",
+        "request_us", "parse_us", "lock_us", "max_lock_us", "connects", "reuses");
+    server.SetResponseDelay(std::chrono::milliseconds(20));
+    for (size_t concurrency : { 1, 4, 16 }) {
+        RunScenario(port, 15000, 3 * scale, concurrency);
+    }
+    server.SetResponseDelay(std::chrono::milliseconds(0));
+
+    // Universe discovery through /coins/list
+    server.SetCoinListSize(15000);
+    {
+        PriceManagerConfig config;
+        config.api_endpoint = HttpEndpoint{ "127.0.0.1", port };
+        config.start_update_thread = false;
+        config.persist_watchlist = false;
+        config.persist_ticks = false;
+        config.log_to_console = false;
+        PriceManager manager(std::make_unique<PosixHttpTransport>(), config);
+
+        auto start = std::chrono::steady_clock::now();
+        bool loaded = manager.LoadCoinUniverse();
+        manager.UpdatePrices();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::printf("\nFull universe: loaded=%s, %zu coins priced in %.1f ms (list + first refresh)\n",
+            loaded ? "yes" : "no", manager.GetLastFetchStats().coins_updated, ms);
+    }
+
+    RunSchedulerScenarios(server, port);
+
+    server.Stop();
+    return 0;
+}
@@ -0,0 +1,152 @@
+#include "PriceManager.h"
+#include "PosixHttpTransport.h"
+#include "MockPriceServer.h"
+#include "BenchUtil.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Multi-provider fetch benchmark
+ *
+ * Runs three local MockPriceServers as stand-in providers and times
+ * PriceManager::UpdatePrices with one provider, with all three and a
+ * majority quorum, and with all three required: once with a spread of
+ * latencies, then with the third provider hanging or answering 503.
+ * Finally one provider quotes 10x off-market and the consensus of each
+ * method is compared with a single healthy provider.
+ */
+
+namespace {
+
+constexpr size_t COINS = 1000;
+constexpr int ROUNDS = 20;
+
+struct Provider {
+    MockPriceServer server;
+    uint16_t port = 0;
+};
+
+PriceManagerConfig ProviderConfig(std::vector<Provider*> sources, size_t quorum, ConsensusMethod method,
+    std::chrono::milliseconds timeout) {
+    PriceManagerConfig config;
+    config.start_update_thread = false;
+    config.persist_watchlist = false;
+    config.persist_ticks = false;
+    config.log_to_console = false;
+    config.provider_quorum = quorum;
+    config.consensus = method;
+    config.provider_transport_factory = [] { return std::make_unique<PosixHttpTransport>(); };
+    for (size_t i = 0; i < sources.size(); ++i) {
+        PriceProviderConfig provider;
+        provider.name = "mock-" + std::to_string(i);
+        provider.endpoint = HttpEndpoint{ "127.0.0.1", sources[i]->port };
+        provider.timeout = timeout;
+        config.providers.push_back(provider);
+    }
+    return config;
+}
+
+void RunLatency(const char* label, std::vector<Provider*> sources, size_t quorum) {
+    PriceManager manager(std::make_unique<PosixHttpTransport>(),
+        ProviderConfig(sources, quorum, ConsensusMethod::Median, std::chrono::milliseconds(300)));
+    manager.SetTrackedCoins(MakeUniverse(COINS));
+    manager.UpdatePrices().get();   // Warm up connections
+
+    std::vector<double> request_ms;
+    size_t merged = 0, updated = 0;
+    for (int i = 0; i < ROUNDS; ++i) {
+        manager.UpdatePrices().get();
+        FetchStats stats = manager.GetLastFetchStats();
+        request_ms.push_back(stats.request_us / 1000.0);
+        merged += stats.providers_merged;
+        updated += stats.coins_updated;
+    }
+    std::sort(request_ms.begin(), request_ms.end());
+
+    uint64_t cut_off = 0;
+    for (const ProviderStats& stats : manager.GetProviderStats()) {
+        cut_off += stats.cut_off;
+    }
+    std::printf("%-28s %6zu %8zu %10.1f %10.1f %8.1f %8zu %8llu\n", label, sources.size(), quorum,
+        request_ms[request_ms.size() / 2], request_ms.back(), static_cast<double>(merged) / ROUNDS,
+        updated / ROUNDS, static_cast<unsigned long long>(cut_off));
+}
+
+std::vector<double> FetchPrices(PriceManager& manager) {
+    manager.SetTrackedCoins(MakeUniverse(COINS));
+    manager.UpdatePrices().get();
+    std::shared_ptr<const CoinSnapshot> snapshot = manager.GetSnapshot();
+    std::vector<double> prices(snapshot->store.Size());
+    for (size_t i = 0; i < prices.size(); ++i) {
+        prices[i] = snapshot->store.Price(i);
+    }
+    return prices;
+}
+
+void RunOutlier(const char* label, std::vector<Provider*> sources, ConsensusMethod method, Provider& reference) {
+    PriceManager manager(std::make_unique<PosixHttpTransport>(),
+        ProviderConfig(sources, sources.size(), method, std::chrono::milliseconds(0)));
+    std::vector<double> consensus = FetchPrices(manager);
+
+    PriceManager healthy(std::make_unique<PosixHttpTransport>(),
+        ProviderConfig({ &reference }, 1, ConsensusMethod::Median, std::chrono::milliseconds(0)));
+    std::vector<double> truth = FetchPrices(healthy);
+
+    std::vector<double> deviation;
+    for (size_t i = 0; i < consensus.size() && i < truth.size(); ++i) {
+        if (truth[i] > 0.0) deviation.push_back(std::fabs(consensus[i] / truth[i] - 1.0) * 100.0);
+    }
+    std::sort(deviation.begin(), deviation.end());
+    std::printf("%-28s %14.2f %14.2f\n", label, deviation[deviation.size() / 2], deviation.back());
+}
+
+} // namespace
+
+int main() {
+    Provider fast, medium, slow;
+    fast.port = fast.server.Start();
+    medium.port = medium.server.Start();
+    slow.port = slow.server.Start();
+    if (fast.port == 0 || medium.port == 0 || slow.port == 0) {
+        std::fprintf(stderr, "Failed to start mock price servers\n");
+        return 1;
+    }
+    fast.server.SetResponseDelay(std::chrono::milliseconds(5));
+    medium.server.SetResponseDelay(std::chrono::milliseconds(15));
+    slow.server.SetResponseDelay(std::chrono::milliseconds(120));
+
+    std::printf("Multi-provider fetch (%zu coins, providers answer in 5 / 15 / 120 ms, timeout 300 ms)\n\n", COINS);
+    std::printf("%-28s %6s %8s %10s %10s %8s %8s %8s\n",
+        "scenario", "provs", "quorum", "median_ms", "max_ms", "merged", "coins", "cut_off");
+    RunLatency("slow provider alone", { &slow }, 1);
+    RunLatency("fast provider alone", { &fast }, 1);
+    RunLatency("3 providers, all required", { &fast, &medium, &slow }, 3);
+    RunLatency("3 providers, majority", { &fast, &medium, &slow }, 0);
+
+    slow.server.SetResponseDelay(std::chrono::milliseconds(0));
+    slow.server.SetFailure(MockPriceServer::Failure::Hang);
+    RunLatency("third hangs, all required", { &fast, &medium, &slow }, 3);
+    RunLatency("third hangs, majority", { &fast, &medium, &slow }, 0);
+
+    slow.server.SetFailure(MockPriceServer::Failure::ServerError);
+    RunLatency("third answers 503, majority", { &fast, &medium, &slow }, 0);
+
+    fast.server.SetResponseDelay(std::chrono::milliseconds(0));
+    medium.server.SetResponseDelay(std::chrono::milliseconds(0));
+    slow.server.SetFailure(MockPriceServer::Failure::None);
+    slow.server.SetPriceScale(10.0);
+    std::printf("\nOne of three providers quotes 10x (deviation from a healthy provider, %%)\n\n");
+    std::printf("%-28s %14s %14s\n", "consensus", "median", "max");
+    RunOutlier("median", { &fast, &medium, &slow }, ConsensusMethod::Median, fast);
+    RunOutlier("weighted mean", { &fast, &medium, &slow }, ConsensusMethod::WeightedMean, fast);
+
+    fast.server.Stop();
+    medium.server.Stop();
+    slow.server.Stop();
+    return 0;
+}
@@ -0,0 +1,227 @@
+#include "TickQueue.h"
+#include "PriceResponseParser.h"
+#include "BenchUtil.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fetch-to-consumer handoff benchmark
+ *
+ * A producer thread publishes batches of price updates for 15k coins
+ * (one batch per simulated fetch) to one consumer that spends a fixed
+ * time per update. Compared are a mutex-guarded vector the consumer
+ * processes under the lock (like a reader holding the data lock while it
+ * works), the same vector swapped out under the lock (the tick log's
+ * handoff) and the TickQueue. Reports the producer's time per batch, the
+ * most updates held at once and whether the consumer ended with each
+ * coin's last price, once with a consumer that keeps up and once with
+ * one that does not.
+ */
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+constexpr size_t COINS = 15000;
+constexpr size_t MOVED = 3000;                  // Updates per batch
+constexpr int BATCHES = 200;
+constexpr std::chrono::microseconds BATCH_GAP{ 5000 };
+
+double UsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Busy-wait standing in for per-update consumer work
+ */
+void Work(std::chrono::nanoseconds cost) {
+    if (cost.count() == 0) return;
+    auto until = Clock::now() + cost;
+    while (Clock::now() < until) {}
+}
+
+/**
+ * @brief Producer-side numbers of one run
+ */
+struct RunResult {
+    double batch_avg_us = 0.0;
+    double batch_max_us = 0.0;
+    size_t peak_held = 0;           // Most updates waiting for the consumer at once
+    uint64_t delivered = 0;
+    uint64_t conflated = 0;
+    bool final_prices_match = true;
+};
+
+/**
+ * @brief Deterministic price batches: which coins move and their new prices
+ */
+struct Feed {
+    std::vector<std::vector<PriceUpdate>> batches;
+    std::vector<double> last_price;
+
+    Feed() : last_price(COINS, 0.0) {
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<uint32_t> coin(0, COINS - 1);
+        std::normal_distribution<double> step(0.0, 0.001);
+        std::vector<double> price(COINS, 100.0);
+        batches.resize(BATCHES);
+        for (int b = 0; b < BATCHES; ++b) {
+            for (size_t m = 0; m < MOVED; ++m) {
+                uint32_t slot = coin(rng);
+                price[slot] *= 1.0 + step(rng);
+                PriceUpdate update;
+                update.timestamp_ms = b;
+                update.price = price[slot];
+                update.slot = slot;
+                update.fields = StagedQuote::HAS_PRICE;
+                batches[b].push_back(update);
+                last_price[slot] = price[slot];
+            }
+        }
+    }
+};
+
+/**
+ * @brief Mutex + vector handoff; 'hold' processes under the lock instead of swapping
+ */
+RunResult RunMutex(const Feed& feed, std::chrono::nanoseconds cost, bool hold) {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<PriceUpdate> pending;
+    bool done = false;
+    RunResult result;
+    std::vector<double> seen(COINS, 0.0);
+
+    std::thread consumer([&] {
+        std::vector<PriceUpdate> local;
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            cv.wait(lock, [&] { return done || !pending.empty(); });
+            if (pending.empty() && done) break;
+            if (hold) {
+                for (const PriceUpdate& update : pending) {
+                    seen[update.slot] = update.price;
+                    Work(cost);
+                }
+                result.delivered += pending.size();
+                pending.clear();
+                continue;
+            }
+            local.swap(pending);
+            lock.unlock();
+            for (const PriceUpdate& update : local) {
+                seen[update.slot] = update.price;
+                Work(cost);
+            }
+            result.delivered += local.size();
+            local.clear();
+            lock.lock();
+        }
+    });
+
+    for (const auto& batch : feed.batches) {
+        auto start = Clock::now();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.insert(pending.end(), batch.begin(), batch.end());
+            result.peak_held = std::max(result.peak_held, pending.size());
+        }
+        cv.notify_one();
+        double us = UsSince(start);
+        result.batch_avg_us += us / BATCHES;
+        result.batch_max_us = std::max(result.batch_max_us, us);
+        std::this_thread::sleep_for(BATCH_GAP);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+    }
+    cv.notify_one();
+    consumer.join();
+
+    for (size_t i = 0; i < COINS; ++i) {
+        result.final_prices_match &= seen[i] == feed.last_price[i];
+    }
+    return result;
+}
+
+RunResult RunQueue(const Feed& feed, std::chrono::nanoseconds cost, size_t capacity) {
+    std::vector<CoinInfo> universe = MakeUniverse(COINS);
+    TickQueue queue(std::make_shared<const CoinCatalog>(universe), capacity);
+    std::atomic<bool> done{ false };
+    RunResult result;
+    std::vector<double> seen(COINS, 0.0);
+
+    std::thread consumer([&] {
+        std::vector<PriceUpdate> local;
+        for (;;) {
+            bool finished = done.load(std::memory_order_acquire);
+            if (queue.Drain(local) == 0) {
+                if (finished) break;
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                continue;
+            }
+            for (const PriceUpdate& update : local) {
+                seen[update.slot] = update.price;
+                Work(cost);
+            }
+        }
+    });
+
+    for (const auto& batch : feed.batches) {
+        auto start = Clock::now();
+        for (const PriceUpdate& update : batch) {
+            queue.Push(update);
+        }
+        double us = UsSince(start);
+        result.batch_avg_us += us / BATCHES;
+        result.batch_max_us = std::max(result.batch_max_us, us);
+        std::this_thread::sleep_for(BATCH_GAP);
+    }
+    done.store(true, std::memory_order_release);
+    consumer.join();
+
+    TickQueueStats stats = queue.Stats();
+    result.delivered = stats.delivered;
+    result.conflated = stats.conflated;
+    result.peak_held = queue.Capacity() + (stats.conflated ? COINS : 0);  // Ring plus the per-coin table
+    for (size_t i = 0; i < COINS; ++i) {
+        result.final_prices_match &= seen[i] == feed.last_price[i];
+    }
+    return result;
+}
+
+void Print(const char* label, const RunResult& result) {
+    std::printf("%-24s %12.1f %12.1f %11zu %11llu %11llu %6s\n", label, result.batch_avg_us, result.batch_max_us,
+        result.peak_held, static_cast<unsigned long long>(result.delivered),
+        static_cast<unsigned long long>(result.conflated), result.final_prices_match ? "yes" : "NO");
+}
+
+void RunScenario(const Feed& feed, std::chrono::nanoseconds cost) {
+    double per_batch_ms = static_cast<double>(cost.count()) * MOVED / 1e6;
+    std::printf("\nConsumer work %lld ns per update (%.1f ms per batch, a batch every %.1f ms)\n",
+        static_cast<long long>(cost.count()), per_batch_ms, BATCH_GAP.count() / 1000.0);
+    std::printf("%-24s %12s %12s %11s %11s %11s %6s\n", "handoff", "push_avg_us", "push_max_us",
+        "peak_held", "delivered", "conflated", "final");
+    Print("mutex, work under lock", RunMutex(feed, cost, true));
+    Print("mutex, swap", RunMutex(feed, cost, false));
+    Print("TickQueue 16k", RunQueue(feed, cost, 16384));
+    Print("TickQueue 1k", RunQueue(feed, cost, 1024));
+}
+
+} // namespace
+
+int main() {
+    Feed feed;
+    std::printf("Handoff of %d batches x %zu price updates over %zu coins\n", BATCHES, MOVED, COINS);
+    RunScenario(feed, std::chrono::nanoseconds(200));     // Keeps up
+    RunScenario(feed, std::chrono::nanoseconds(4000));    // Falls behind
+    return 0;
+}
@@ -0,0 +1,141 @@
+#include "PriceManager.h"
+#include "PosixHttpTransport.h"
+#include "MockPriceServer.h"
+#include "BenchUtil.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Per-coin refresh scheduling benchmark
+ *
+ * A MockPriceServer quotes a time-based price model in which a small
+ * share of the coins swing by a few percent and the rest barely move.
+ * PriceManager polls it with the background scheduler under one request
+ * budget, first refreshing every coin at the same interval, then with
+ * volatility-adaptive intervals (also with some volatile coins on the
+ * watchlist). The displayed prices are sampled against the server's true
+ * price: tracking error of volatile, calm and watchlist coins, requests
+ * sent and the interval spread the scheduler settled on. Time scales are
+ * shrunk (seconds instead of minutes) to keep the run short.
+ */
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+constexpr size_t COINS = 3000;
+constexpr size_t WATCHED = 20;                  // Volatile coins put on the watchlist
+constexpr double VOLATILE_SHARE = 0.05;
+constexpr double AMPLITUDE = 0.02;              // +-2% swing of volatile coins
+constexpr std::chrono::milliseconds PERIOD{ 20000 };
+constexpr double REQUESTS_PER_MINUTE = 600.0;
+constexpr std::chrono::seconds WARM_UP{ 12 };    // First pass over every coin takes ~8 s at this budget
+constexpr std::chrono::seconds RUN{ 20 };
+
+/**
+ * @brief Mean and 99th percentile of the relative tracking error
+ */
+struct ErrorSummary {
+    std::vector<double> samples;
+
+    double Mean() const {
+        double sum = 0.0;
+        for (double e : samples) sum += e;
+        return samples.empty() ? 0.0 : sum / static_cast<double>(samples.size());
+    }
+
+    double P99() {
+        if (samples.empty()) return 0.0;
+        auto at = samples.begin() + static_cast<std::ptrdiff_t>(samples.size() * 99 / 100);
+        std::nth_element(samples.begin(), at, samples.end());
+        return *at;
+    }
+};
+
+void RunScenario(const char* label, MockPriceServer& server, uint16_t port, bool adaptive, bool watchlist) {
+    PriceManagerConfig config;
+    config.api_endpoint = HttpEndpoint{ "127.0.0.1", port };
+    config.persist_watchlist = false;
+    config.persist_ticks = false;
+    config.log_to_console = false;
+    config.max_request_path = 500;              // ~40 coins per request
+    config.update_interval = std::chrono::milliseconds(8000);   // Every coin fits the budget at this pace
+    config.api_budget.requests_per_minute = REQUESTS_PER_MINUTE;
+    config.api_budget.burst = 10.0;
+    config.refresh.adaptive = adaptive;
+    config.refresh.min_interval = std::chrono::milliseconds(1000);
+    config.refresh.max_interval = std::chrono::milliseconds(30000);
+    config.refresh.target_move = 0.002;
+
+    std::vector<CoinInfo> universe = MakeUniverse(COINS);
+    std::vector<char> is_volatile(COINS), is_watched(COINS);
+    size_t watched = 0;
+    for (size_t i = 0; i < COINS; ++i) {
+        is_volatile[i] = server.IsVolatile(universe[i].id);
+        if (watchlist && is_volatile[i] && watched < WATCHED) {
+            is_watched[i] = 1;
+            ++watched;
+        }
+    }
+
+    uint64_t requests_before = server.RequestsServed();
+    PriceManager polling(std::make_unique<PosixHttpTransport>(), config);
+    polling.SetTrackedCoins(universe);
+    for (size_t i = 0; i < COINS; ++i) {
+        if (is_watched[i]) polling.AddToWatchlist(universe[i].id);
+    }
+    std::this_thread::sleep_for(WARM_UP);
+
+    // Compare what a reader sees with the true price, five times a second
+    ErrorSummary volatile_error, calm_error, watched_error;
+    auto start = Clock::now();
+    while (Clock::now() - start < RUN) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        auto now = Clock::now();
+        std::shared_ptr<const CoinSnapshot> snapshot = polling.GetSnapshot();
+        for (size_t i = 0; i < COINS; ++i) {
+            double truth = server.PriceAt(snapshot->store.Catalog().Id(i), now);
+            double error = std::fabs(snapshot->store.Price(i) - truth) / truth * 10000.0;
+            if (is_watched[i]) watched_error.samples.push_back(error);
+            else if (is_volatile[i]) volatile_error.samples.push_back(error);
+            else calm_error.samples.push_back(error);
+        }
+    }
+    double seconds = std::chrono::duration<double>(RUN + WARM_UP).count();
+    double requests = static_cast<double>(server.RequestsServed() - requests_before);
+    RefreshStats spread = polling.GetRefreshStats();
+
+    std::printf("%-28s %8.1f %8.1f %8.1f %8.1f %9.1f %9.1f %7.1f %8.1f %8.1f\n", label,
+        volatile_error.Mean(), volatile_error.P99(), calm_error.Mean(), calm_error.P99(),
+        watched_error.Mean(), requests / seconds,
+        spread.min_interval_ms / 1000.0, spread.median_interval_ms / 1000.0, spread.max_interval_ms / 1000.0);
+}
+
+} // namespace
+
+int main() {
+    MockPriceServer server;
+    uint16_t port = server.Start();
+    if (port == 0) {
+        std::fprintf(stderr, "Failed to start mock server\n");
+        return 1;
+    }
+    server.SetPriceWaves(VOLATILE_SHARE, AMPLITUDE, PERIOD);
+
+    std::printf("Refresh scheduling (%zu coins, %.0f%% swinging +-%.0f%% per %lld s, the rest 50x calmer; "
+        "budget %.0f requests/min, %lld s each)\n", COINS, VOLATILE_SHARE * 100.0, AMPLITUDE * 100.0,
+        static_cast<long long>(PERIOD.count() / 1000), REQUESTS_PER_MINUTE, static_cast<long long>(RUN.count()));
+    std::printf("Tracking error in basis points of the true price\n\n");
+    std::printf("%-28s %8s %8s %8s %8s %9s %9s %7s %8s %8s\n", "schedule", "vol_avg", "vol_p99",
+        "calm_avg", "calm_p99", "watch_avg", "req/s", "min_s", "median_s", "max_s");
+    RunScenario("fixed 8 s interval", server, port, false, false);
+    RunScenario("adaptive", server, port, true, false);
+    RunScenario("adaptive + watchlist", server, port, true, true);
+
+    server.Stop();
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include "CoinCatalog.h"
+#include "BenchUtil.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Coin search benchmark
+ *
+ * Times CoinSearchIndex queries against the per-coin lowercase-and-find
+ * loop the All Cryptocurrencies table used to run, for queries of growing
+ * length (as typed into the Search box).
+ */
+
+namespace {
+
+// The previous filter: copy and lowercase name and symbol for every coin
+size_t LegacySearch(const CoinCatalog& catalog, std::string search_term, std::vector<uint32_t>& out) {
+    out.clear();
+    std::transform(search_term.begin(), search_term.end(), search_term.begin(), ::tolower);
+    for (size_t i = 0; i < catalog.Size(); ++i) {
+        std::string name_lower(catalog.Name(i));
+        std::string symbol_lower(catalog.Symbol(i));
+        std::transform(name_lower.begin(), name_lower.end(), name_lower.begin(), ::tolower);
+        std::transform(symbol_lower.begin(), symbol_lower.end(), symbol_lower.begin(), ::tolower);
+        if (name_lower.find(search_term) != std::string::npos ||
+            symbol_lower.find(search_term) != std::string::npos) {
+            out.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return out.size();
+}
+
+template <typename Fn>
+double TimeUs(int rounds, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        fn();
+    }
+    return std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+void RunScenario(size_t coin_count) {
+    auto build_start = std::chrono::steady_clock::now();
+    CoinCatalog catalog(MakeUniverse(coin_count));
+    double build_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - build_start).count();
+
+    std::printf("\n%zu coins (catalog + indexes built in %.1f ms, search index %.1f B/coin)\n",
+        coin_count, build_ms, static_cast<double>(catalog.Search().MemoryBytes()) / coin_count);
+    std::printf("%-14s %8s %12s %12s\n", "query", "matches", "index_us", "legacy_us");
+
+    const char* queries[] = { "c", "c1", "coi", "Coin 1", "coin 12", "COIN 1234", "c999", "zzz" };
+    const int rounds = 50;
+    std::vector<uint32_t> matches, legacy_matches;
+
+    for (const char* query : queries) {
+        double index_us = TimeUs(rounds, [&] { catalog.Search().Find(query, matches); });
+        double legacy_us = TimeUs(rounds / 5, [&] { LegacySearch(catalog, query, legacy_matches); });
+
+        std::printf("%-14s %8zu %12.1f %12.1f%s\n", query, matches.size(), index_us, legacy_us,
+            matches == legacy_matches ? "" : "   MISMATCH");
+    }
+}
+
+} // namespace
+
+int main() {
+    std::printf("Coin search benchmark (microseconds per query)\n");
+
+    RunScenario(1000);
+    RunScenario(15000);
+    RunScenario(100000);
+    return 0;
+}
@@ -0,0 +1,163 @@
+#include "CryptoUI.h"
+#include "PosixHttpTransport.h"
+#include "MockPriceServer.h"
+#include "BenchUtil.h"
+#include "HeadlessImGui.h"
+#include <imgui.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
+
+/**
+ * @brief Sparkline benchmark
+ *
+ * Times LTTB on one full history ring, then renders CryptoUI headless with
+ * hundreds of watchlisted coins whose history was filled from a local
+ * MockPriceServer, so every watchlist row draws a sparkline. Reports the
+ * CPU time of steady frames (sparklines served from the cache), of the
+ * frame after a new tick (every visible sparkline rebuilt), and what
+ * rebuilding all of them every frame would cost. Heap allocations made
+ * through operator new are counted per steady frame.
+ */
+
+namespace {
+
+std::atomic<size_t> allocation_count{ 0 };
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double UsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+double RunFrame(CryptoUI& ui) {
+    auto start = Clock::now();
+    ImGui::NewFrame();
+    ui.Render();
+    ImGui::Render();
+    return UsSince(start);
+}
+
+double Median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+void RunLttb() {
+    std::vector<PriceSample> series;
+    for (int i = 0; i < 2880; ++i) {
+        series.push_back({ i * 30000LL, 100.0 + 10.0 * std::sin(i * 0.01) + (i % 97 == 0 ? 5.0 : 0.0) });
+    }
+    std::vector<PriceSample> out;
+    const int rounds = 2000;
+    auto start = Clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        DownsampleLttb(series.data(), series.size(), 64, out);
+    }
+    std::printf("LTTB 2880 -> %zu samples: %.2f us\n\n", out.size(), UsSince(start) / rounds);
+}
+
+void RunScenario(uint16_t port, size_t watched, int ticks) {
+    PriceManagerConfig config;
+    config.api_endpoint = HttpEndpoint{ "127.0.0.1", port };
+    config.start_update_thread = false;
+    config.persist_watchlist = false;
+    config.persist_ticks = false;
+    config.log_to_console = false;
+    auto manager = std::make_shared<PriceManager>(std::make_unique<PosixHttpTransport>(), config);
+    std::vector<CoinInfo> universe = MakeUniverse(1000);
+    manager->SetTrackedCoins(universe);
+    for (size_t i = 0; i < watched; ++i) {
+        manager->AddToWatchlist(universe[i].id);
+    }
+    for (int t = 0; t < ticks; ++t) {
+        manager->UpdatePrices();
+    }
+
+    // Tall enough for every watchlist row to be visible
+    ImGui::GetIO().DisplaySize = ImVec2(1280, 300.0f + 24.0f * watched);
+
+    CryptoUI ui(manager);
+    for (int i = 0; i < 50; ++i) {
+        RunFrame(ui);
+    }
+
+    const int frames = 100;
+    std::vector<double> steady;
+    steady.reserve(frames);
+    size_t allocations_before = allocation_count.load();
+    for (int i = 0; i < frames; ++i) {
+        steady.push_back(RunFrame(ui));
+    }
+    size_t allocations = allocation_count.load() - allocations_before;
+
+    std::vector<double> after_tick;
+    for (int i = 0; i < 10; ++i) {
+        manager->UpdatePrices();
+        after_tick.push_back(RunFrame(ui));
+    }
+
+    // What redrawing without the cache would add per frame
+    std::shared_ptr<const PriceHistory> history = manager->GetPriceHistory();
+    std::vector<PriceSample> window, reduced;
+    auto start = Clock::now();
+    for (size_t i = 0; i < watched; ++i) {
+        history->ReadWindow(i, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(), window);
+        DownsampleLttb(window.data(), window.size(), 64, reduced);
+    }
+    double uncached_us = UsSince(start);
+
+    std::printf("%8zu %8zu %12.1f %14.1f %14.1f %12.2f %10d\n", watched, history->Capacity() < static_cast<size_t>(ticks) ?
+        history->Capacity() : static_cast<size_t>(ticks), Median(steady), Median(after_tick), uncached_us,
+        static_cast<double>(allocations) / frames, ImGui::GetDrawData()->TotalVtxCount);
+}
+
+} // namespace
+
+int main() {
+    MockPriceServer server;
+    uint16_t port = server.Start();
+    if (port == 0) {
+        std::fprintf(stderr, "Failed to start mock price server\n");
+        return 1;
+    }
+    CreateHeadlessImGuiContext();
+
+    std::printf("Sparkline benchmark (median CPU microseconds per frame)\n\n");
+    RunLttb();
+
+    std::printf("%8s %8s %12s %14s %14s %12s %10s\n",
+        "rows", "samples", "steady_us", "after_tick_us", "uncached_us", "allocs/frame", "vertices");
+    RunScenario(port, 100, 600);
+    RunScenario(port, 300, 600);
+    RunScenario(port, 500, 600);
+
+    ImGui::DestroyContext();
+    server.Stop();
+    return 0;
+}
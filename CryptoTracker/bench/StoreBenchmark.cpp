@@ -0,0 +1,160 @@
+#include "CoinStore.h"
+#include "BenchUtil.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Coin storage layout benchmark
+ *
+ * Compares the previous array-of-structs layout (one struct with three
+ * std::string members per coin) against CoinCatalog + CoinStore: bytes
+ * per coin (lookup and search indexes are reported separately) and the cost of the scans the UI and analytics run (watchlist
+ * filter, top movers, aggregate statistics).
+ */
+
+namespace {
+
+/**
+ * @brief The coin record as it was stored before the columnar layout
+ */
+struct LegacyCoin {
+    std::string id;
+    std::string symbol;
+    std::string name;
+    double price = 0.0;
+    double change_24h = 0.0;
+    bool in_watchlist = false;
+};
+
+size_t StringHeapBytes(const std::string& value) {
+    // Strings that do not fit the small-string buffer own a heap block
+    return value.capacity() > std::string().capacity() ? value.capacity() + 1 : 0;
+}
+
+template <typename Fn>
+double TimeUs(int rounds, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        fn();
+    }
+    return std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+void RunScenario(size_t coin_count) {
+    std::vector<CoinInfo> universe = MakeUniverse(coin_count);
+
+    // Same synthetic market data in both layouts
+    std::vector<LegacyCoin> legacy;
+    legacy.reserve(coin_count);
+    CoinStore store(std::make_shared<const CoinCatalog>(universe));
+    for (size_t i = 0; i < coin_count; ++i) {
+        double price = 1.0 + static_cast<double>(i % 997);
+        double change = std::sin(static_cast<double>(i)) * 12.0;
+        bool watched = i % 50 == 0;
+
+        LegacyCoin coin;
+        coin.id = universe[i].id;
+        coin.symbol = universe[i].symbol;
+        coin.name = universe[i].name;
+        coin.price = price;
+        coin.change_24h = change;
+        coin.in_watchlist = watched;
+        legacy.push_back(std::move(coin));
+
+        store.SetPrice(i, price, 0);
+        store.SetChange(i, change);
+        store.SetWatchlist(i, watched);
+    }
+
+    size_t legacy_bytes = legacy.capacity() * sizeof(LegacyCoin);
+    for (const auto& coin : legacy) {
+        legacy_bytes += StringHeapBytes(coin.id) + StringHeapBytes(coin.symbol) + StringHeapBytes(coin.name);
+    }
+    size_t index_bytes = store.Catalog().Index().MemoryBytes() + store.Catalog().Search().MemoryBytes();
+    size_t catalog_bytes = store.Catalog().MemoryBytes() - index_bytes;
+    size_t column_bytes = store.ColumnBytes();
+
+    const int rounds = coin_count > 50000 ? 50 : 200;
+    size_t sink = 0;
+    double sink_f = 0.0;
+
+    // Watchlist filter
+    double legacy_filter_us = TimeUs(rounds, [&] {
+        std::vector<size_t> result;
+        for (size_t i = 0; i < legacy.size(); ++i) {
+            if (legacy[i].in_watchlist) result.push_back(i);
+        }
+        sink += result.size();
+    });
+    double store_filter_us = TimeUs(rounds, [&] {
+        sink += store.WatchlistIndices().size();
+    });
+
+    // Top 20 movers by |change|
+    double legacy_movers_us = TimeUs(rounds, [&] {
+        std::vector<size_t> order(legacy.size());
+        for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+        std::partial_sort(order.begin(), order.begin() + 20, order.end(), [&](size_t a, size_t b) {
+            return std::fabs(legacy[a].change_24h) > std::fabs(legacy[b].change_24h);
+        });
+        sink += order[0];
+    });
+    double store_movers_us = TimeUs(rounds, [&] {
+        sink += store.TopMovers(20)[0];
+    });
+
+    // Gainers / losers / mean change
+    double legacy_stats_us = TimeUs(rounds, [&] {
+        size_t gainers = 0;
+        double sum = 0.0;
+        for (const auto& coin : legacy) {
+            gainers += coin.change_24h > 0.0;
+            sum += coin.change_24h;
+        }
+        sink += gainers;
+        sink_f += sum;
+    });
+    double store_stats_us = TimeUs(rounds, [&] {
+        CoinStats stats = store.ComputeStats();
+        sink += stats.gainers;
+        sink_f += stats.mean_change_24h;
+    });
+
+    // Snapshot copy (what every publication pays)
+    double legacy_copy_us = TimeUs(rounds / 10, [&] {
+        std::vector<LegacyCoin> copy = legacy;
+        sink += copy.size();
+    });
+    double store_copy_us = TimeUs(rounds / 10, [&] {
+        CoinStore copy = store;
+        sink += copy.Size();
+    });
+
+    std::printf("%8zu  %-6s %9.1f %10.1f %10.1f %10.1f %10.1f\n", coin_count, "AoS",
+        static_cast<double>(legacy_bytes) / coin_count,
+        legacy_filter_us, legacy_movers_us, legacy_stats_us, legacy_copy_us);
+    std::printf("%8s  %-6s %9.1f %10.1f %10.1f %10.1f %10.1f   (strings %.1f + columns %.1f; indexes %.1f B/coin)\n",
+        "", "SoA", static_cast<double>(catalog_bytes + column_bytes) / coin_count,
+        store_filter_us, store_movers_us, store_stats_us, store_copy_us,
+        static_cast<double>(catalog_bytes) / coin_count, static_cast<double>(column_bytes) / coin_count,
+        static_cast<double>(index_bytes) / coin_count);
+    if (sink == 0 && sink_f == 0.0) std::printf("\n");  // Keep the scans observable
+}
+
+} // namespace
+
+int main() {
+    std::printf("Coin storage benchmark (bytes per coin, microseconds per scan)\n\n");
+    std::printf("%8s  %-6s %9s %10s %10s %10s %10s\n",
+        "coins", "layout", "B/coin", "filter_us", "movers_us", "stats_us", "copy_us");
+
+    RunScenario(1000);
+    RunScenario(15000);
+    RunScenario(100000);
+    return 0;
+}
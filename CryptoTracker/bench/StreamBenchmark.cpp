@@ -0,0 +1,230 @@
+#include "PriceManager.h"
+#include "PosixHttpTransport.h"
+#include "MockPriceServer.h"
+#include "MockTickerServer.h"
+#include "BenchUtil.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Ticker stream benchmark
+ *
+ * Times TickerStreamParser on its own, then runs PriceManager in streaming
+ * mode against a local MockTickerServer: messages/sec it sustains while the
+ * server floods it, send-to-snapshot latency of the probe ticker at a fixed
+ * message rate for several batch intervals, and the fallback to polling
+ * (against a MockPriceServer) when the stream drops and is refused, plus
+ * the time to resubscribe once the stream is back.
+ */
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+constexpr size_t COINS = 1000;
+
+double NowUs() {
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(
+        Clock::now().time_since_epoch()).count());
+}
+
+double MsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::vector<CoinInfo> StreamUniverse() {
+    std::vector<CoinInfo> universe = MakeUniverse(COINS);
+    universe.emplace_back("probe", MockTickerServer::PROBE_SYMBOL, "Probe");
+    return universe;
+}
+
+PriceManagerConfig StreamConfig(uint16_t ticker_port, std::chrono::milliseconds batch_interval) {
+    PriceManagerConfig config;
+    config.start_update_thread = false;
+    config.persist_watchlist = false;
+    config.persist_ticks = false;
+    config.log_to_console = false;
+    config.stream_prices = true;
+    config.stream_endpoint = HttpEndpoint{ "127.0.0.1", ticker_port };
+    config.stream_batch_interval = batch_interval;
+    config.stream_reconnect_delay = std::chrono::milliseconds(100);
+    return config;
+}
+
+template <typename Predicate>
+bool WaitFor(Predicate done, std::chrono::milliseconds timeout) {
+    auto deadline = Clock::now() + timeout;
+    while (!done()) {
+        if (Clock::now() >= deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+void RunParser() {
+    std::vector<CoinInfo> universe = StreamUniverse();
+    CoinCatalog catalog(universe);
+    TickerSymbolMap symbols(catalog);
+    std::vector<StagedQuote> staging(universe.size());
+    std::vector<uint32_t> dirty;
+
+    // Capture one 100-ticker message from the mock's format
+    std::string message = "[";
+    char entry[256];
+    for (size_t i = 0; i < 100; ++i) {
+        std::snprintf(entry, sizeof(entry),
+            "%s{\"e\":\"24hrTicker\",\"E\":1700000000000,\"s\":\"C%zuUSDT\",\"p\":\"0.10000000\",\"P\":\"1.250\","
+            "\"w\":\"10.00000000\",\"x\":\"9.90000000\",\"c\":\"%zu.12345678\",\"Q\":\"1.00000000\",\"b\":\"10.00000000\","
+            "\"B\":\"10.00000000\",\"a\":\"10.00000000\",\"A\":\"10.00000000\",\"o\":\"9.90000000\",",
+            i ? "," : "", i, i);
+        message += entry;
+        message += "\"h\":\"10.50000000\",\"l\":\"9.50000000\",\"v\":\"12345.00000000\",\"q\":\"67890.00000000\","
+            "\"O\":1699913600000,\"C\":1700000000000,\"F\":1,\"L\":1000,\"n\":1000}";
+    }
+    message += "]";
+
+    const int rounds = 5000;
+    size_t tickers = 0;
+    auto start = Clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        tickers += TickerStreamParser::Parse(message, symbols, "USDT", staging, dirty).tickers;
+        for (uint32_t slot : dirty) staging[slot].fields = 0;
+        dirty.clear();
+    }
+    double ms = MsSince(start);
+    std::printf("Parser: %.1f us per 100-ticker message (%.1f KiB), %.2f M tickers/s\n\n",
+        ms * 1000.0 / rounds, message.size() / 1024.0, tickers / (ms / 1000.0) / 1e6);
+}
+
+void RunThroughput(MockTickerServer& server, uint16_t port, size_t tickers_per_message) {
+    server.SetMessageRate(0.0);
+    server.SetTickersPerMessage(tickers_per_message);
+
+    PriceManager manager(std::make_unique<PosixHttpTransport>(), StreamConfig(port, std::chrono::milliseconds(100)));
+    manager.SetTrackedCoins(StreamUniverse());
+    WaitFor([&] { return manager.GetStreamStats().batches > 2; }, std::chrono::milliseconds(5000));
+
+    StreamStats before = manager.GetStreamStats();
+    auto start = Clock::now();
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    StreamStats after = manager.GetStreamStats();
+    double seconds = MsSince(start) / 1000.0;
+
+    std::printf("%10zu %14.0f %14.0f %10.1f %12.1f\n", tickers_per_message,
+        (after.messages - before.messages) / seconds, (after.tickers - before.tickers) / seconds,
+        (after.batches - before.batches) / seconds, after.last_batch_lock_us);
+}
+
+void RunLatency(MockTickerServer& server, uint16_t port, double rate, std::chrono::milliseconds batch_interval) {
+    server.SetMessageRate(rate);
+    server.SetTickersPerMessage(20);
+
+    PriceManager manager(std::make_unique<PosixHttpTransport>(), StreamConfig(port, batch_interval));
+    manager.SetTrackedCoins(StreamUniverse());
+    size_t probe = manager.GetSnapshot()->store.Catalog().Index().FindById("probe");
+    WaitFor([&] { return manager.GetStreamStats().batches > 2; }, std::chrono::milliseconds(5000));
+
+    // A reader woken by each publication sees the probe's send time
+    std::vector<double> latencies;
+    uint64_t version = manager.GetDataVersion();
+    auto end = Clock::now() + std::chrono::seconds(2);
+    while (Clock::now() < end) {
+        if (!manager.WaitForDataChange(version, std::chrono::milliseconds(100))) continue;
+        std::shared_ptr<const CoinSnapshot> snapshot = manager.GetSnapshot();
+        version = snapshot->version;
+        latencies.push_back((NowUs() - snapshot->store.Price(probe)) / 1000.0);
+    }
+    std::sort(latencies.begin(), latencies.end());
+    if (latencies.empty()) {
+        std::printf("%10.0f %10lld %12s\n", rate, static_cast<long long>(batch_interval.count()), "no updates");
+        return;
+    }
+    std::printf("%10.0f %10lld %12zu %12.2f %12.2f %12.2f\n", rate, static_cast<long long>(batch_interval.count()),
+        latencies.size(), latencies[latencies.size() / 2], latencies[latencies.size() * 99 / 100], latencies.back());
+}
+
+void RunFallback(MockTickerServer& ticker_server, uint16_t ticker_port) {
+    MockPriceServer price_server;
+    uint16_t price_port = price_server.Start();
+    ticker_server.SetMessageRate(100.0);
+    ticker_server.SetTickersPerMessage(20);
+
+    PriceManagerConfig config = StreamConfig(ticker_port, std::chrono::milliseconds(100));
+    config.api_endpoint = HttpEndpoint{ "127.0.0.1", price_port };
+    config.start_update_thread = true;
+    config.update_interval = std::chrono::milliseconds(500);
+    config.refresh.adaptive = false;            // Poll everything at once when the stream drops
+    config.stream_reconnect_delay = std::chrono::milliseconds(200);
+    PriceManager manager(std::make_unique<PosixHttpTransport>(), config);
+
+    WaitFor([&] { return manager.IsStreaming(); }, std::chrono::milliseconds(5000));
+    uint64_t polls_before = price_server.RequestsServed();
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    uint64_t polls_streaming = price_server.RequestsServed() - polls_before;
+
+    // Drop the stream and refuse to resubscribe: polling has to take over
+    ticker_server.SetRejectHandshakes(true);
+    uint64_t polls_at_drop = price_server.RequestsServed();
+    auto dropped = Clock::now();
+    ticker_server.DropConnections();
+    WaitFor([&] { return !manager.IsStreaming(); }, std::chrono::milliseconds(5000));
+    double detect_ms = MsSince(dropped);
+    WaitFor([&] { return price_server.RequestsServed() > polls_at_drop; }, std::chrono::milliseconds(5000));
+    double first_poll_ms = MsSince(dropped);
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    uint64_t polls_down = price_server.RequestsServed() - polls_at_drop;
+
+    ticker_server.SetRejectHandshakes(false);
+    auto restored = Clock::now();
+    WaitFor([&] { return manager.IsStreaming(); }, std::chrono::milliseconds(5000));
+    double resubscribe_ms = MsSince(restored);
+
+    StreamStats stats = manager.GetStreamStats();
+    std::printf("Fallback (poll interval 500 ms, reconnect delay 200 ms):\n"
+        "  polls while streaming (2 s): %llu\n"
+        "  drop noticed after %.1f ms, first poll after %.1f ms, %llu polls while down (2 s)\n"
+        "  resubscribed %.1f ms after the stream came back (%llu connects, %llu disconnects)\n",
+        static_cast<unsigned long long>(polls_streaming), detect_ms, first_poll_ms,
+        static_cast<unsigned long long>(polls_down), resubscribe_ms,
+        static_cast<unsigned long long>(stats.connects), static_cast<unsigned long long>(stats.disconnects));
+    price_server.Stop();
+}
+
+} // namespace
+
+int main() {
+    MockTickerServer server;
+    server.SetUniverseSize(COINS);
+    uint16_t port = server.Start();
+    if (port == 0) {
+        std::fprintf(stderr, "Failed to start mock ticker server\n");
+        return 1;
+    }
+
+    std::printf("Ticker stream benchmark (%zu coins, Binance-style 24hrTicker messages)\n\n", COINS);
+    RunParser();
+
+    std::printf("Throughput (server floods, 100 ms batches)\n");
+    std::printf("%10s %14s %14s %10s %12s\n", "tickers/msg", "messages/s", "tickers/s", "batches/s", "lock_us");
+    RunThroughput(server, port, 1);
+    RunThroughput(server, port, 20);
+    RunThroughput(server, port, 100);
+
+    std::printf("\nLatency, send to published snapshot (ms; polling every 30 s averages 15000)\n");
+    std::printf("%10s %10s %12s %12s %12s %12s\n", "msgs/s", "batch_ms", "samples", "median", "p99", "max");
+    RunLatency(server, port, 1000.0, std::chrono::milliseconds(0));
+    RunLatency(server, port, 1000.0, std::chrono::milliseconds(20));
+    RunLatency(server, port, 1000.0, std::chrono::milliseconds(100));
+    RunLatency(server, port, 10000.0, std::chrono::milliseconds(20));
+
+    std::printf("\n");
+    RunFallback(server, port);
+
+    server.Stop();
+    return 0;
+}
@@ -0,0 +1,199 @@
+#include "TickLog.h"
+#include "PriceHistory.h"
+#include "BenchUtil.h"
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/**
+ * @brief Tick log benchmark
+ *
+ * Writes 15k-coin ticks through TickLog (writer thread, synced batches) and
+ * reports the hand-off cost on the caller and the write throughput, then
+ * times reopening the log (index files + tail check) against reading all
+ * segment bytes, one-coin window queries through the mappings, seeding the
+ * in-memory history rings, and recovery after a writer process is killed
+ * mid-write and after garbage is left at the end of the last segment.
+ */
+
+namespace {
+
+namespace fs = std::filesystem;
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t COINS = 15000;
+constexpr int64_t TICK_MS = 30000;
+
+double MsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::vector<uint64_t> CoinKeys(const std::vector<CoinInfo>& universe) {
+    std::vector<uint64_t> keys;
+    for (const auto& coin : universe) {
+        keys.push_back(TickLog::CoinKey(coin.id));
+    }
+    return keys;
+}
+
+std::vector<TickRecord> MakeTick(const std::vector<uint64_t>& keys, int64_t tick) {
+    std::vector<TickRecord> batch;
+    batch.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        batch.push_back({ tick * TICK_MS, 1.0 + static_cast<double>(i) + tick * 0.01, keys[i] });
+    }
+    return batch;
+}
+
+TickLogOptions BenchOptions(const fs::path& dir) {
+    TickLogOptions options;
+    options.directory = dir;
+    options.segment_bytes = 16 * 1024 * 1024;
+    return options;
+}
+
+double ReadAllBytesMs(const fs::path& dir, uint64_t& bytes) {
+    auto start = Clock::now();
+    std::vector<char> buffer;
+    bytes = 0;
+    for (const auto& entry : fs::directory_iterator(dir)) {
+        if (entry.path().extension() != ".log") continue;
+        std::ifstream in(entry.path(), std::ios::binary);
+        buffer.resize(static_cast<size_t>(entry.file_size()));
+        in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        bytes += buffer.size();
+    }
+    return MsSince(start);
+}
+
+} // namespace
+
+int main() {
+    fs::path dir = fs::temp_directory_path() / "cryptotracker_tick_bench";
+    fs::remove_all(dir);
+
+    std::vector<CoinInfo> universe = MakeUniverse(COINS);
+    std::vector<uint64_t> keys = CoinKeys(universe);
+    const int64_t ticks = 300;
+
+    std::printf("Tick log benchmark (%zu coins x %lld ticks, 16 MiB segments, synced batches)\n\n",
+        COINS, static_cast<long long>(ticks));
+
+    // Write
+    {
+        TickLog log(BenchOptions(dir));
+        std::vector<std::vector<TickRecord>> batches;
+        for (int64_t t = 0; t < ticks; ++t) {
+            batches.push_back(MakeTick(keys, t));
+        }
+
+        // One tick at a time, as the fetch thread does: the writer is idle when Append() is called
+        double append_us = 0.0, append_us_max = 0.0;
+        auto start = Clock::now();
+        for (auto& batch : batches) {
+            auto call = Clock::now();
+            log.Append(std::move(batch));
+            double us = MsSince(call) * 1000.0;
+            append_us += us;
+            append_us_max = std::max(append_us_max, us);
+            log.Flush();
+        }
+        double written_ms = MsSince(start);
+
+        TickLogStats stats = log.GetStats();
+        std::printf("Write: Append() %.1f us per tick (max %.1f us); written + synced %.2f ms per tick, "
+            "%llu records / %.1f MiB (%.0f MiB/s), %zu segments\n",
+            append_us / ticks, append_us_max, written_ms / ticks, static_cast<unsigned long long>(stats.records),
+            stats.bytes / (1024.0 * 1024.0), stats.bytes / (1024.0 * 1024.0) / (written_ms / 1000.0),
+            stats.segments);
+    }
+
+    // Reopen
+    {
+        uint64_t bytes = 0;
+        double read_all_ms = ReadAllBytesMs(dir, bytes);
+        auto start = Clock::now();
+        TickLog log(BenchOptions(dir));
+        double open_ms = MsSince(start);
+        std::printf("Open: %.2f ms (%zu segments, %llu records); reading all %.1f MiB instead: %.1f ms\n",
+            open_ms, log.GetStats().segments, static_cast<unsigned long long>(log.GetStats().records),
+            bytes / (1024.0 * 1024.0), read_all_ms);
+
+        // Queries
+        std::vector<PriceSample> out;
+        int64_t newest = (ticks - 1) * TICK_MS;
+        struct Window { const char* label; int64_t from; } windows[] = {
+            { "whole log", 0 }, { "last hour", newest - 3600 * 1000 }, { "last 5 min", newest - 300 * 1000 },
+        };
+        for (const Window& window : windows) {
+            const int reads = 10;
+            start = Clock::now();
+            for (int r = 0; r < reads; ++r) {
+                log.Read(keys[static_cast<size_t>(r) * 997 % COINS], window.from, newest, out);
+            }
+            std::printf("Read one coin (%s): %.2f ms, %zu samples\n", window.label, MsSince(start) / reads, out.size());
+        }
+
+        // Startup seeding of the in-memory rings
+        auto catalog = std::make_shared<const CoinCatalog>(universe);
+        PriceHistory rings(catalog, 2880, 64 * 1024 * 1024);
+        start = Clock::now();
+        size_t seeded = log.Replay(rings, newest - static_cast<int64_t>(rings.Capacity()) * TICK_MS);
+        std::printf("Seed history rings (%zu per coin): %.1f ms for %zu records\n",
+            rings.Capacity(), MsSince(start), seeded);
+    }
+
+    // Writer process killed mid-write
+    uint64_t records_before = TickLog(BenchOptions(dir)).GetStats().records;
+    pid_t child = fork();
+    if (child == 0) {
+        TickLogOptions options = BenchOptions(dir);
+        options.sync_writes = false;
+        TickLog log(options);
+        for (int64_t t = ticks; ; ++t) {
+            log.Append(MakeTick(keys, t));
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    kill(child, SIGKILL);
+    waitpid(child, nullptr, 0);
+    {
+        TickLog log(BenchOptions(dir));
+        TickLogStats stats = log.GetStats();
+        std::printf("\nKilled writer: reopened with %llu records (%llu before the child), %llu torn bytes truncated\n",
+            static_cast<unsigned long long>(stats.records), static_cast<unsigned long long>(records_before),
+            static_cast<unsigned long long>(stats.recovered_bytes));
+    }
+
+    // Garbage at the end of the last segment (lost or reordered page writes)
+    uint64_t records_clean = TickLog(BenchOptions(dir)).GetStats().records;
+    fs::path last;
+    for (const auto& entry : fs::directory_iterator(dir)) {
+        if (entry.path().extension() == ".log" && entry.path() > last) last = entry.path();
+    }
+    {
+        std::ofstream out(last, std::ios::binary | std::ios::app);
+        std::vector<char> junk(3 * sizeof(TickRecord) + 7, 0);
+        for (size_t i = 0; i < junk.size(); i += 3) junk[i] = static_cast<char>(i);
+        out.write(junk.data(), static_cast<std::streamsize>(junk.size()));
+    }
+    {
+        TickLog log(BenchOptions(dir));
+        TickLogStats stats = log.GetStats();
+        std::printf("Garbage tail: reopened with %llu records (%llu before), %llu bytes truncated\n",
+            static_cast<unsigned long long>(stats.records), static_cast<unsigned long long>(records_clean),
+            static_cast<unsigned long long>(stats.recovered_bytes));
+    }
+
+    fs::remove_all(dir);
+    return 0;
+}
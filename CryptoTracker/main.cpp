@@ -3,11 +3,15 @@
 #include <imgui/imgui_impl_dx11.h>
 #include <d3d11.h>
 #include <tchar.h>
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include "PriceManager.h"
 #include "CryptoUI.h"
 
+// Render only when input, data or an animation requires it (false: render at vsync continuously)
+static constexpr bool RENDER_ON_DEMAND = true;
+
 // DirectX11 data
 static ID3D11Device* g_pd3dDevice = nullptr;
 static ID3D11DeviceContext* g_pd3dDeviceContext = nullptr;
@@ -28,11 +32,12 @@ LRESULT WINAPI WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
  * - Win32 window
  * - DirectX 11 for rendering
  * - ImGui context and backends
- * - PriceManager (starts background thread)
+ * - PriceManager (starts the polling and ticker stream threads)
  * - CryptoUI for rendering interface
  *
  * Main loop:
  * - Processes Windows messages
+ * - Sleeps until input or a PriceManager change signal when nothing needs drawing
  * - Updates ImGui frame
  * - Renders UI
  * - Presents to screen
@@ -77,10 +82,21 @@ int main(int, char**) {
 
     // Initialize application components
     std::cout << "Initializing Crypto Tracker..." << std::endl;
-    auto price_manager = std::make_shared<PriceManager>();
-    CryptoUI ui(price_manager);
+    PriceManagerConfig config;
+    config.stream_prices = true;    // Live exchange tickers; polls CoinGecko while the stream is down
+    config.api_budget.requests_per_minute = 10.0;   // CoinGecko's keyless tier allows roughly 10-30
+    config.api_budget.burst = 5.0;
+    config.change_epsilon = 0.005;  // 24h change moves below the two decimals shown are not changes
+    auto price_manager = std::make_shared<PriceManager>(CreateDefaultTransport(), config);
+    auto ui = std::make_unique<CryptoUI>(price_manager);
     std::cout << "Initialization complete!" << std::endl;
 
+    // Signalled from PriceManager threads so a sleeping loop wakes for new data
+    HANDLE data_changed_event = ::CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    price_manager->SetDataChangedCallback([data_changed_event](uint64_t) {
+        ::SetEvent(data_changed_event);
+    });
+
     // Main loop
     bool done = false;
     while (!done) {
@@ -91,17 +107,27 @@ int main(int, char**) {
             ::DispatchMessage(&msg);
             if (msg.message == WM_QUIT)
                 done = true;
+            ui->OnInputEvent();
         }
         if (done)
             break;
 
+        // Nothing to draw: block until a message, a data change or the next animation frame
+        if (RENDER_ON_DEMAND && !ui->NeedsFrame()) {
+            auto idle = ui->IdleTimeout();
+            DWORD timeout = idle == FramePacer::Clock::duration::max() ? INFINITE :
+                static_cast<DWORD>(std::chrono::ceil<std::chrono::milliseconds>(idle).count());
+            ::MsgWaitForMultipleObjectsEx(1, &data_changed_event, timeout, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+            continue;
+        }
+
         // Start the Dear ImGui frame
         ImGui_ImplDX11_NewFrame();
         ImGui_ImplWin32_NewFrame();
         ImGui::NewFrame();
 
         // Render our UI
-        ui.Render();
+        ui->Render();
 
         // Rendering
         ImGui::Render();
@@ -113,7 +139,11 @@ int main(int, char**) {
         g_pSwapChain->Present(1, 0); // Present with vsync
     }
 
-    // Cleanup
+    // Cleanup: join the manager's threads before closing the event, since a
+    // thread may still hold a copy of the callback that signals it
+    ui.reset();
+    price_manager.reset();
+    ::CloseHandle(data_changed_event);
     ImGui_ImplDX11_Shutdown();
     ImGui_ImplWin32_Shutdown();
     ImGui::DestroyContext();
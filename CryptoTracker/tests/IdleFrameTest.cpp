@@ -0,0 +1,105 @@
+#include "CryptoUI.h"
+#include "FramePacer.h"
+#include "BenchUtil.h"
+#include "HeadlessImGui.h"
+#include "TestUtil.h"
+#include <imgui.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+/**
+ * @brief Frames an idle render-on-demand UI draws
+ *
+ * Drives FramePacer alone and CryptoUI on a headless ImGui context through
+ * simulated minutes on an explicit clock, the way main() blocks between
+ * frames. An idle minute may only draw the start-up frames, and a data
+ * change must draw exactly settle_frames frames, then go idle again.
+ */
+
+namespace {
+
+using Clock = FramePacer::Clock;
+constexpr auto VSYNC = std::chrono::microseconds(16667);
+constexpr auto MINUTE = std::chrono::seconds(60);
+
+/**
+ * @brief Run the pacer's loop until 'end'; returns the frames it rendered
+ */
+uint64_t RunPacer(FramePacer& pacer, Clock::time_point& now, Clock::time_point end) {
+    uint64_t before = pacer.FramesRendered();
+    while (now < end) {
+        if (pacer.ShouldRender(now)) {
+            pacer.FrameRendered(false, now);
+            now += VSYNC;
+            continue;
+        }
+        Clock::duration idle = pacer.TimeUntilNextFrame(now);
+        now = idle == Clock::duration::max() ? end : std::min(end, now + idle);
+    }
+    return pacer.FramesRendered() - before;
+}
+
+/**
+ * @brief Run the UI's loop until 'end'; returns the frames it rendered
+ */
+uint64_t RunUi(CryptoUI& ui, Clock::time_point& now, Clock::time_point end) {
+    uint64_t before = ui.FramesRendered();
+    while (now < end) {
+        if (ui.NeedsFrame(now)) {
+            ImGui::GetIO().DeltaTime = std::chrono::duration<float>(VSYNC).count();
+            ImGui::NewFrame();
+            ui.Render(now);
+            ImGui::Render();
+            now += VSYNC;
+            continue;
+        }
+        Clock::duration idle = ui.IdleTimeout(now);
+        now = idle == Clock::duration::max() ? end : std::min(end, now + idle);
+    }
+    return ui.FramesRendered() - before;
+}
+
+void TestPacerIdleMinute() {
+    FramePacer pacer(5);
+    Clock::time_point now = Clock::now();
+    CHECK(RunPacer(pacer, now, now + MINUTE) == 5);     // Start-up frames only
+    CHECK(RunPacer(pacer, now, now + MINUTE) == 0);
+
+    pacer.RequestFrames();
+    CHECK(RunPacer(pacer, now, now + MINUTE) == 5);
+    CHECK(pacer.TimeUntilNextFrame(now) == Clock::duration::max());
+}
+
+void TestUiIdleMinute() {
+    PriceManagerConfig config;
+    config.start_update_thread = false;
+    config.persist_watchlist = false;
+    config.persist_ticks = false;
+    config.log_to_console = false;
+    auto manager = std::make_shared<PriceManager>(CreateDefaultTransport(), config);
+    manager->SetTrackedCoins(MakeUniverse(1000));
+    CryptoUI ui(manager);
+    const uint64_t settle_frames = FramePacer().SettleFrames();    // CryptoUI's pacer
+
+    Clock::time_point now = Clock::now();
+    uint64_t frames = RunUi(ui, now, now + MINUTE);
+    CHECK(frames <= settle_frames);
+    CHECK(RunUi(ui, now, now + MINUTE) == 0);
+
+    // A data change draws its settle frames, then the UI is idle again
+    manager->AddToWatchlist("coin-00001");
+    CHECK(RunUi(ui, now, now + MINUTE) == settle_frames);
+    CHECK(ui.IdleTimeout(now) == Clock::duration::max());
+    CHECK(ui.FramesRendered() <= 2 * settle_frames);
+}
+
+} // namespace
+
+int main() {
+    CreateHeadlessImGuiContext();
+    TestPacerIdleMinute();
+    TestUiIdleMinute();
+    ImGui::DestroyContext();
+    return TestResult();
+}
@@ -0,0 +1,84 @@
+#include "PriceManager.h"
+#include "PosixHttpTransport.h"
+#include "MockPriceServer.h"
+#include "MockTickerServer.h"
+#include "BenchUtil.h"
+#include "TestUtil.h"
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Polling of coins the ticker stream does not cover
+ *
+ * Streams 20 coins from a MockTickerServer while a 21st coin has no
+ * ticker. With the stream connected, that coin must still be polled from
+ * the MockPriceServer at its refresh interval, and the polls must leave
+ * out the coins the stream keeps fresh.
+ */
+
+namespace {
+
+constexpr size_t STREAMED = 20;
+constexpr std::chrono::milliseconds INTERVAL{ 2000 };
+
+void TestUnstreamedCoinIsPolled(uint16_t price_port, uint16_t ticker_port) {
+    PriceManagerConfig config;
+    config.api_endpoint = HttpEndpoint{ "127.0.0.1", price_port };
+    config.persist_watchlist = false;
+    config.persist_ticks = false;
+    config.log_to_console = false;
+    config.update_interval = INTERVAL;
+    config.refresh.adaptive = false;            // Every coin at INTERVAL
+    config.stream_prices = true;
+    config.stream_endpoint = HttpEndpoint{ "127.0.0.1", ticker_port };
+    config.stream_batch_interval = std::chrono::milliseconds(50);
+    config.stream_reconnect_delay = std::chrono::milliseconds(100);
+    PriceManager manager(std::make_unique<PosixHttpTransport>(), config);
+
+    std::vector<CoinInfo> universe = MakeUniverse(STREAMED);
+    universe.emplace_back("unstreamed", "NOTICKER", "Unstreamed");
+    manager.SetTrackedCoins(universe);
+    CHECK(WaitFor([&] { return manager.IsStreaming() && manager.GetStreamStats().batches > 2; },
+        std::chrono::milliseconds(5000)));
+
+    size_t slot = manager.GetSnapshot()->store.Catalog().Index().FindById("unstreamed");
+    CHECK(slot != CoinIndex::NOT_FOUND);
+    if (slot == CoinIndex::NOT_FOUND) return;
+
+    // The mock quotes a new price on every request, so each poll moves it
+    int polls = 0;
+    double last = manager.GetSnapshot()->store.Price(slot);
+    auto end = std::chrono::steady_clock::now() + INTERVAL * 5 / 2;
+    while (std::chrono::steady_clock::now() < end) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        double price = manager.GetSnapshot()->store.Price(slot);
+        if (price != last) {
+            ++polls;
+            last = price;
+        }
+    }
+    CHECK(manager.IsStreaming());
+    CHECK(polls >= 2);
+    CHECK(manager.GetLastFetchStats().coins_due == 1);
+}
+
+} // namespace
+
+int main() {
+    MockPriceServer price_server;
+    MockTickerServer ticker_server;
+    ticker_server.SetUniverseSize(STREAMED);
+    ticker_server.SetTickersPerMessage(STREAMED);
+    ticker_server.SetMessageRate(50.0);
+    uint16_t price_port = price_server.Start();
+    uint16_t ticker_port = ticker_server.Start();
+    CHECK(price_port != 0 && ticker_port != 0);
+    if (price_port != 0 && ticker_port != 0) {
+        TestUnstreamedCoinIsPolled(price_port, ticker_port);
+    }
+    ticker_server.Stop();
+    price_server.Stop();
+    return TestResult();
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+/**
+ * @brief Failed CHECKs so far; a test's main() returns TestResult()
+ */
+inline int test_failures = 0;
+
+/**
+ * @brief Report a failed condition and keep going
+ */
+#define CHECK(condition)                                                            \
+    do {                                                                            \
+        if (!(condition)) {                                                         \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++test_failures;                                                        \
+        }                                                                           \
+    } while (0)
+
+inline int TestResult() {
+    if (test_failures == 0) {
+        std::printf("All checks passed\n");
+        return 0;
+    }
+    std::fprintf(stderr, "%d check(s) failed\n", test_failures);
+    return 1;
+}
+
+/**
+ * @brief Poll 'done' every millisecond until it holds or 'timeout' passes
+ * @return false on timeout
+ */
+template <typename Predicate>
+bool WaitFor(Predicate done, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!done()) {
+        if (std::chrono::steady_clock::now() >= deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
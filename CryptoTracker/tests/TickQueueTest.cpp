@@ -0,0 +1,184 @@
+#include "TickQueue.h"
+#include "AlertEngine.h"
+#include "PriceResponseParser.h"
+#include "BenchUtil.h"
+#include "TestUtil.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fields of conflated and superseded TickQueue updates
+ *
+ * Fills a two-entry ring so later pushes are conflated, and checks that
+ * every field an update moved reaches the consumer even when the update
+ * itself is replaced by a newer one of its coin, and that an alert on a
+ * field the newer update did not move still triggers. Then runs a producer
+ * and a consumer concurrently on a small ring and checks that the last move
+ * of each field of each coin is reported, in order.
+ */
+
+namespace {
+
+PriceUpdate Update(uint32_t slot, double price, double change, uint8_t fields) {
+    PriceUpdate update;
+    update.slot = slot;
+    update.price = price;
+    update.change_24h = change;
+    update.fields = fields;
+    return update;
+}
+
+const PriceUpdate* Find(const std::vector<PriceUpdate>& updates, uint32_t slot) {
+    const PriceUpdate* found = nullptr;
+    for (const PriceUpdate& update : updates) {
+        if (update.slot == slot) {
+            CHECK(found == nullptr);    // At most one update per coin here
+            found = &update;
+        }
+    }
+    return found;
+}
+
+void TestConflatedFieldsAccumulate(const std::shared_ptr<const CoinCatalog>& catalog) {
+    TickQueue queue(catalog, 2);
+    queue.Push(Update(1, 10.0, 0.0, StagedQuote::HAS_PRICE));
+    queue.Push(Update(1, 11.0, 0.0, StagedQuote::HAS_PRICE));       // Ring full
+    queue.Push(Update(0, 2.0, 1.0, StagedQuote::HAS_PRICE));
+    queue.Push(Update(0, 2.0, 5.0, StagedQuote::HAS_CHANGE));       // Replaces the entry above
+
+    std::vector<PriceUpdate> out;
+    queue.Drain(out);
+    const PriceUpdate* coin = Find(out, 0);
+    CHECK(coin != nullptr);
+    if (coin) {
+        CHECK(coin->fields == (StagedQuote::HAS_PRICE | StagedQuote::HAS_CHANGE));
+        CHECK(coin->change_24h == 5.0);
+    }
+    CHECK(queue.Stats().conflated == 2);
+}
+
+void TestSupersededFieldsMerge(const std::shared_ptr<const CoinCatalog>& catalog) {
+    // The ring keeps coin 0's price move; its newer change-only update is conflated
+    TickQueue queue(catalog, 2);
+    queue.Push(Update(0, 2.0, 1.0, StagedQuote::HAS_PRICE));
+    queue.Push(Update(1, 10.0, 0.0, StagedQuote::HAS_PRICE));       // Ring full
+    queue.Push(Update(0, 2.0, 5.0, StagedQuote::HAS_CHANGE));
+
+    std::vector<PriceUpdate> out;
+    CHECK(queue.Drain(out) == 2);
+    const PriceUpdate* coin = Find(out, 0);
+    CHECK(coin != nullptr);
+    if (coin) {
+        CHECK(coin->fields == (StagedQuote::HAS_PRICE | StagedQuote::HAS_CHANGE));
+        CHECK(coin->price == 2.0);
+        CHECK(coin->change_24h == 5.0);
+    }
+    CHECK(queue.Stats().superseded == 1);
+
+    // Later updates of the coin are delivered again
+    queue.Push(Update(0, 3.0, 5.0, StagedQuote::HAS_PRICE));
+    CHECK(queue.Drain(out) == 1);
+    CHECK(out.size() == 1 && out[0].price == 3.0);
+}
+
+void TestAlertSeesMergedField(const std::shared_ptr<const CoinCatalog>& catalog) {
+    AlertEngine engine;
+    engine.Bind(catalog);
+    AlertRule rule;
+    rule.coin_id = std::string(catalog->Id(0));
+    rule.threshold = 1.5;
+    CHECK(engine.Add(rule) != 0);
+    engine.Evaluate(Update(0, 1.0, 0.0, StagedQuote::HAS_PRICE));  // First value arms the alert
+
+    // The price crossing arrives only as a superseded update's field
+    TickQueue queue(catalog, 2);
+    queue.Push(Update(0, 2.0, 1.0, StagedQuote::HAS_PRICE));
+    queue.Push(Update(1, 10.0, 0.0, StagedQuote::HAS_PRICE));
+    queue.Push(Update(0, 2.0, 5.0, StagedQuote::HAS_CHANGE));
+
+    std::vector<PriceUpdate> out;
+    queue.Drain(out);
+    size_t fired = 0;
+    for (const PriceUpdate& update : out) {
+        fired += engine.Evaluate(update);
+    }
+    CHECK(fired == 1);
+}
+
+void TestConcurrentFieldsReported(const std::shared_ptr<const CoinCatalog>& catalog) {
+    constexpr int BURSTS = 500;
+    constexpr int ROUNDS = 3;
+    size_t coins = catalog->Size();
+    TickQueue queue(catalog, 16);
+    std::vector<double> moved_price(coins, 0.0), moved_change(coins, 0.0);
+    std::atomic<int> bursts_pushed{ 0 };
+    std::atomic<int> bursts_checked{ 0 };
+
+    // Each round moves one field of every coin, alternating per round and
+    // coin; after each burst the producer waits until the consumer checked
+    std::thread producer([&] {
+        int round = 0;
+        for (int burst = 1; burst <= BURSTS; ++burst) {
+            for (int i = 0; i < ROUNDS; ++i) {
+                ++round;
+                for (uint32_t slot = 0; slot < coins; ++slot) {
+                    uint8_t fields = (round + slot) % 2 ? StagedQuote::HAS_PRICE : StagedQuote::HAS_CHANGE;
+                    (fields == StagedQuote::HAS_PRICE ? moved_price : moved_change)[slot] = round;
+                    queue.Push(Update(slot, moved_price[slot], moved_change[slot], fields));
+                }
+            }
+            bursts_pushed.store(burst, std::memory_order_release);
+            while (bursts_checked.load(std::memory_order_acquire) < burst) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<double> seen_price(coins, 0.0), seen_change(coins, 0.0);
+    size_t missed = 0, out_of_order = 0;
+    std::vector<PriceUpdate> out;
+    auto consume = [&] {
+        queue.Drain(out);
+        for (const PriceUpdate& update : out) {
+            if (update.fields & StagedQuote::HAS_PRICE) {
+                out_of_order += update.price < seen_price[update.slot];
+                seen_price[update.slot] = update.price;
+            }
+            if (update.fields & StagedQuote::HAS_CHANGE) {
+                out_of_order += update.change_24h < seen_change[update.slot];
+                seen_change[update.slot] = update.change_24h;
+            }
+        }
+    };
+    for (int checked = 0; checked < BURSTS;) {
+        consume();
+        if (bursts_pushed.load(std::memory_order_acquire) > checked) {
+            // The burst is complete: the latest move of every field must be in
+            consume();
+            for (size_t slot = 0; slot < coins; ++slot) {
+                missed += seen_price[slot] != moved_price[slot];
+                missed += seen_change[slot] != moved_change[slot];
+            }
+            bursts_checked.store(++checked, std::memory_order_release);
+        }
+    }
+    producer.join();
+    CHECK(missed == 0);
+    CHECK(out_of_order == 0);
+    if (missed || out_of_order) {
+        std::fprintf(stderr, "%zu field(s) missed, %zu out of order\n", missed, out_of_order);
+    }
+}
+
+} // namespace
+
+int main() {
+    auto catalog = std::make_shared<const CoinCatalog>(MakeUniverse(4));
+    TestConflatedFieldsAccumulate(catalog);
+    TestSupersededFieldsMerge(catalog);
+    TestAlertSeesMergedField(catalog);
+    TestConcurrentFieldsReported(std::make_shared<const CoinCatalog>(MakeUniverse(256)));
+    return TestResult();
+}